@@ -0,0 +1,22 @@
+ldr r0,=0x20200000
+mov r1,#0x40000
+str r1,[r0,#4]
+mov r1,#0x10000
+mov r3,#5
+blink:
+str r1,[r0,#28]
+mov r2,#0xff00
+on:
+sub r2,r2,#1
+cmp r2,#0
+bne on
+str r1,[r0,#40]
+mov r2,#0xff00
+off:
+sub r2,r2,#1
+cmp r2,#0
+bne off
+sub r3,r3,#1
+cmp r3,#0
+bne blink
+andeq r0,r0,r0
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "asm_cache.h"
+#include "encoder.h"
+
+#define CACHE_MAGIC 0x434d5341 // "ASMC"
+// bumped whenever a line may encode differently or new syntax is
+// accepted, so that caches from older assemblers are not replayed
+#define CACHE_VERSION 4 // .space and _start
+#define INITIAL_CAPACITY 1024
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+#define BRANCH_OFFSET_MASK 0x00ffffff
+#define LITERAL_OFFSET_MASK 0xfff
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t length;
+} cache_header;
+
+line_cache *new_cache(void) {
+	line_cache *cache = malloc(sizeof(line_cache));
+	cache->capacity = INITIAL_CAPACITY;
+	cache->length = 0;
+	cache->entries = calloc(cache->capacity, sizeof(cache_entry));
+	return cache;
+}
+
+void free_cache(line_cache *cache) {
+	for (uint32_t i = 0; i < cache->capacity; i++) {
+		free(cache->entries[i].label);
+	}
+	free(cache->entries);
+	free(cache);
+}
+
+/*
+ * FNV-1a over the raw line text
+ */
+uint64_t hash_line(const char *line, uint32_t length) {
+	uint64_t hash = FNV_OFFSET;
+	for (uint32_t i = 0; i < length; i++) {
+		hash ^= (uint8_t) line[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+/*
+ * open addressing with linear probing, an empty slot has length 0
+ */
+static cache_entry *find_slot(line_cache *cache, uint64_t hash, uint32_t length) {
+	uint32_t mask = cache->capacity - 1;
+	uint32_t i = (uint32_t) hash & mask;
+	while (cache->entries[i].length) {
+		if (cache->entries[i].hash == hash && cache->entries[i].length == length) {
+			break;
+		}
+		i = (i + 1) & mask;
+	}
+	return &cache->entries[i];
+}
+
+static void grow(line_cache *cache) {
+	cache_entry *old = cache->entries;
+	uint32_t old_capacity = cache->capacity;
+	cache->capacity *= 2;
+	cache->entries = calloc(cache->capacity, sizeof(cache_entry));
+	for (uint32_t i = 0; i < old_capacity; i++) {
+		if (old[i].length) {
+			*find_slot(cache, old[i].hash, old[i].length) = old[i];
+		}
+	}
+	free(old);
+}
+
+cache_entry *lookup(line_cache *cache, uint64_t hash, uint32_t length) {
+	cache_entry *entry = find_slot(cache, hash, length);
+	return entry->length ? entry : NULL;
+}
+
+static cache_entry *insert(line_cache *cache, uint64_t hash, uint32_t length) {
+	if (2 * (cache->length + 1) > cache->capacity) {
+		grow(cache);
+	}
+	cache_entry *entry = find_slot(cache, hash, length);
+	if (!entry->length) {
+		cache->length++;
+	}
+	free(entry->label);
+	memset(entry, 0, sizeof(cache_entry));
+	entry->hash = hash;
+	entry->length = length;
+	return entry;
+}
+
+cache_entry *record(line_cache *cache, uint64_t hash, uint32_t length, Token *token, uint32_t binary,
+                    uint16_t address, uint16_t last_address, int ldr_index, uint32_t *ldr_imm_values) {
+	fixup_t fixup = FIXUP_NONE;
+	uint32_t base = binary;
+	uint32_t target = 0;
+
+	if (token->opcode == B) {
+		fixup = FIXUP_BRANCH;
+		base &= ~BRANCH_OFFSET_MASK;
+		target = address + ((int32_t) (binary << 8) >> 6) + 8;
+	} else if (ldr_index >= 0) {
+		uint16_t offset = literal_offset(address, last_address, ldr_index);
+		if (offset & ~LITERAL_OFFSET_MASK) {
+			return NULL;            // would not round-trip through the offset field
+		}
+		fixup = FIXUP_LITERAL;
+		base &= ~LITERAL_OFFSET_MASK;
+		target = last_address + ldr_index;
+	}
+
+	cache_entry *entry = insert(cache, hash, length);
+	entry->fixup = fixup;
+	entry->base = base;
+	entry->address = address;
+	entry->target = target;
+	entry->bits = binary;
+	if (fixup == FIXUP_BRANCH) {
+		entry->label = malloc(strlen(token->Content.branch.expression) + 1);
+		strcpy(entry->label, token->Content.branch.expression);
+	} else if (fixup == FIXUP_LITERAL) {
+		entry->literal = ldr_imm_values[ldr_index];
+	}
+	return entry;
+}
+
+/*
+ * the word is only rebuilt when the line or its target moved
+ */
+uint32_t resolve(cache_entry *entry, label_dict *dict, uint16_t address, uint16_t last_address,
+                 uint16_t *ldr_count, uint32_t *ldr_imm_values) {
+	uint32_t target;
+	switch (entry->fixup) {
+	case FIXUP_BRANCH:
+		target = query(entry->label, dict) * 4;
+		if (address != entry->address || target != entry->target) {
+			entry->bits = entry->base | branch_offset(target, address);
+		}
+		break;
+	case FIXUP_LITERAL:
+		target = last_address + *ldr_count;
+		if (address != entry->address || target != entry->target) {
+			entry->bits = entry->base | literal_offset(address, last_address, *ldr_count);
+		}
+		ldr_imm_values[*ldr_count] = entry->literal;
+		*ldr_count = *ldr_count + 1;
+		break;
+	default:
+		return entry->bits;
+	}
+	entry->address = address;
+	entry->target = target;
+	return entry->bits;
+}
+
+// --
+// -- Sidecar file
+// --
+
+line_cache *load_cache(const char *filename) {
+	line_cache *cache = new_cache();
+	FILE *input = fopen(filename, "rb");
+	if (input == NULL) {
+		return cache;
+	}
+
+	cache_header header;
+	if (fread(&header, sizeof(cache_header), 1, input) != 1
+	    || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION) {
+		fclose(input);
+		return cache;
+	}
+
+	for (uint32_t i = 0; i < header.length; i++) {
+		cache_entry read;
+		uint16_t label_length;
+		if (fread(&read.hash, sizeof(uint64_t), 1, input) != 1
+		    || fread(&read.length, sizeof(uint32_t), 1, input) != 1
+		    || fread(&read.fixup, sizeof(fixup_t), 1, input) != 1
+		    || fread(&read.base, sizeof(uint32_t), 1, input) != 1
+		    || fread(&read.literal, sizeof(uint32_t), 1, input) != 1
+		    || fread(&read.address, sizeof(uint16_t), 1, input) != 1
+		    || fread(&read.target, sizeof(uint32_t), 1, input) != 1
+		    || fread(&read.bits, sizeof(uint32_t), 1, input) != 1
+		    || fread(&label_length, sizeof(uint16_t), 1, input) != 1) {
+			break;          // truncated cache, keep what was read
+		}
+		read.label = NULL;
+		if (label_length) {
+			read.label = calloc(label_length + 1, sizeof(char));
+			if (fread(read.label, 1, label_length, input) != label_length) {
+				free(read.label);
+				break;
+			}
+		}
+		cache_entry *entry = insert(cache, read.hash, read.length);
+		read.used = false;
+		*entry = read;
+	}
+
+	fclose(input);
+	return cache;
+}
+
+/*
+ * only entries used by the current source are kept
+ */
+bool save_cache(const char *filename, line_cache *cache) {
+	FILE *output = fopen(filename, "wb");
+	if (output == NULL) {
+		return false;
+	}
+
+	cache_header header = {CACHE_MAGIC, CACHE_VERSION, 0};
+	for (uint32_t i = 0; i < cache->capacity; i++) {
+		header.length += cache->entries[i].used;
+	}
+	fwrite(&header, sizeof(cache_header), 1, output);
+
+	for (uint32_t i = 0; i < cache->capacity; i++) {
+		cache_entry *entry = &cache->entries[i];
+		if (!entry->used) {
+			continue;
+		}
+		uint16_t label_length = entry->label ? strlen(entry->label) : 0;
+		fwrite(&entry->hash, sizeof(uint64_t), 1, output);
+		fwrite(&entry->length, sizeof(uint32_t), 1, output);
+		fwrite(&entry->fixup, sizeof(fixup_t), 1, output);
+		fwrite(&entry->base, sizeof(uint32_t), 1, output);
+		fwrite(&entry->literal, sizeof(uint32_t), 1, output);
+		fwrite(&entry->address, sizeof(uint16_t), 1, output);
+		fwrite(&entry->target, sizeof(uint32_t), 1, output);
+		fwrite(&entry->bits, sizeof(uint32_t), 1, output);
+		fwrite(&label_length, sizeof(uint16_t), 1, output);
+		fwrite(entry->label, 1, label_length, output);
+	}
+
+	return fclose(output) == 0;
+}
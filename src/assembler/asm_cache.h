@@ -0,0 +1,68 @@
+#ifndef AS_CACHE_H
+#define AS_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "define_types.h"
+#include "label_table.h"
+
+/*
+ * Incremental reassembly cache
+ *
+ * Maps the content hash of a source line to its encoded word, so that
+ * unchanged lines are not parsed again. The only position-dependent parts
+ * of an encoding (branch offsets and literal pool offsets) are kept apart
+ * as a fixup and re-resolved against the current label table and layout.
+ */
+
+typedef enum {
+	FIXUP_NONE,
+	FIXUP_BRANCH,
+	FIXUP_LITERAL
+} fixup_t;
+
+typedef struct {
+	uint64_t hash;
+	uint32_t length;        // line length, guards against hash collisions
+	fixup_t fixup;
+	uint32_t base;          // encoded word with the fixup field left clear
+	uint32_t literal;       // FIXUP_LITERAL: value stored in the literal pool
+	char *label;            // FIXUP_BRANCH: branch target
+	bool used;              // seen while assembling the current source
+	// layout the last resolved word was computed for
+	uint16_t address;
+	uint32_t target;
+	uint32_t bits;
+} cache_entry;
+
+typedef struct {
+	uint32_t capacity;
+	uint32_t length;
+	cache_entry *entries;
+} line_cache;
+
+line_cache *new_cache(void);
+
+// returns an empty cache if 'filename' is missing or not a cache file
+line_cache *load_cache(const char *filename);
+
+bool save_cache(const char *filename, line_cache *cache);
+
+void free_cache(line_cache *cache);
+
+uint64_t hash_line(const char *line, uint32_t length);
+
+cache_entry *lookup(line_cache *cache, uint64_t hash, uint32_t length);
+
+// records the encoding of a freshly parsed line placed at 'address',
+// 'ldr_index' is the literal pool slot it used or -1.
+// returns NULL if the line cannot be cached
+cache_entry *record(line_cache *cache, uint64_t hash, uint32_t length, Token *token, uint32_t binary,
+                    uint16_t address, uint16_t last_address, int ldr_index, uint32_t *ldr_imm_values);
+
+// re-resolves the fixup of a cached line placed at 'address'
+uint32_t resolve(cache_entry *entry, label_dict *dict, uint16_t address, uint16_t last_address,
+                 uint16_t *ldr_count, uint32_t *ldr_imm_values);
+
+#endif
@@ -5,6 +5,8 @@
 #include "label_table.h"
 #include "encoder.h"
 #include "parser.h"
+#include "asm_cache.h"
+#include "image_writer.h"
 
 /*
  * 1. verify the number of passed arguments
@@ -13,19 +15,51 @@
  * 4. generate symbol table
  * 5. binary encoding + save the files
  * 6. free the memory + exit
+ *
+ * usage: assemble [-i] [-s] source output
+ * -i reassembles incrementally, reusing the encodings of unchanged lines
+ * from the sidecar cache 'output'.cache
+ * -s writes a sectioned image (see image_writer.h) rather than a flat
+ * binary, starting at the label '_start' if there is one
+ *
+ * '.space bytes' reserves zeroed words, e.g. for a table.
  */
 #define MAX_LINE_LENGTH 512
+#define CACHE_SUFFIX ".cache"
+#define ENTRY_LABEL "_start"
+#define MAX_WORDS (1 << 14) // 64KB, as far as 16 bit addresses go
 int main(int argc, char **argv) {
 
 	//1. verify the number of passed arguments
-	if (argc != 3) {
+	bool incremental = false;
+	bool sectioned = false;
+	bool valid = argc >= 3;
+	for (int i = 1; i < argc - 2; i++) {
+		if (!strcmp(argv[i], "-i")) {
+			incremental = true;
+		} else if (!strcmp(argv[i], "-s")) {
+			sectioned = true;
+		} else {
+			valid = false;
+		}
+	}
+	if (!valid) {
 		fprintf(stderr, "The number of provided arguments is not correct\n");
 		return EXIT_FAILURE;
 	}
 
 	//2. initialize the source and output filenames
-	char *filename_source = argv[1];
-	char *filename_output = argv[2];
+	char *filename_source = argv[argc - 2];
+	char *filename_output = argv[argc - 1];
+
+	line_cache *cache = NULL;
+	char *filename_cache = NULL;
+	if (incremental) {
+		filename_cache = malloc(strlen(filename_output) + strlen(CACHE_SUFFIX) + 1);
+		strcpy(filename_cache, filename_output);
+		strcat(filename_cache, CACHE_SUFFIX);
+		cache = load_cache(filename_cache);
+	}
 
 	//3. load the assembly instructions
 	//4. generate symbol table
@@ -41,6 +75,7 @@ int main(int argc, char **argv) {
 	label_dict *dict = new_dict();
 	uint16_t count = 0;
 	uint16_t ldr_count = 0;
+	uint32_t space;
 
 	while (!feof(input)) {
 		char *p = fgets(line, MAX_LINE_LENGTH, input);
@@ -53,13 +88,22 @@ int main(int argc, char **argv) {
 			add(line, count, dict);
 			continue;
 		}
-		count++;
-		if(strncmp(line,"ldr",3)) {
+		// an instruction or a '.space', in words
+		if (!parse_space(line, &space)) {
+			space = 1;
+		}
+		if (count + space > MAX_WORDS) {
+			fprintf(stderr, "The program does not fit in 64KB\n");
+			exit(EXIT_FAILURE);
+		}
+		count += space;
+		if(!strncmp(line,"ldr",3)) {
 			ldr_count++;
 		}
 	}
 
 	uint32_t *ldr_imm_values = malloc(sizeof(uint32_t) * ldr_count);
+	uint32_t *words = calloc(count + ldr_count, sizeof(uint32_t));
 	ldr_count = 0;
 
 	// parse file again
@@ -72,7 +116,7 @@ int main(int argc, char **argv) {
 	output = fopen(filename_output, "wb");
 	uint32_t binary;
 	Token token;
-	uint16_t address = 0;
+	uint32_t address = 0;
 
 	while (!feof(input)) {
 		char *p = fgets(line, MAX_LINE_LENGTH, input);
@@ -84,19 +128,55 @@ int main(int argc, char **argv) {
 		if (line[n - 2] == ':' || n == 1) {
 			continue;
 		}
+		if (parse_space(line, &space)) {
+			address += space * sizeof(uint32_t);
+			continue;
+		}
 		token.address = address;
-		parse_general(&token, line);
-		instr_to_bits(&token, dict, address, count, &ldr_count,ldr_imm_values, &binary);
-		fwrite(&binary, sizeof(uint32_t), 1, output);
+		if (incremental) {
+			uint64_t hash = hash_line(line, n - 1);
+			cache_entry *entry = lookup(cache, hash, n - 1);
+			if (entry) {
+				binary = resolve(entry, dict, address, count, &ldr_count, ldr_imm_values);
+			} else {
+				uint16_t ldr_index = ldr_count;
+				parse_general(&token, line);
+				instr_to_bits(&token, dict, address, count, &ldr_count, ldr_imm_values, &binary);
+				entry = record(cache, hash, n - 1, &token, binary, address, count,
+				               ldr_count != ldr_index ? ldr_index : -1, ldr_imm_values);
+			}
+			if (entry) {
+				entry->used = true;
+			}
+		} else {
+			parse_general(&token, line);
+			instr_to_bits(&token, dict, address, count, &ldr_count,ldr_imm_values, &binary);
+		}
+		words[address / 4] = binary;
 		address += 4;
 	}
 
-	for(int i = 0; i < ldr_count; i++) {
-		fwrite(&ldr_imm_values[i], sizeof(uint32_t), 1, output);
+	memcpy(&words[count], ldr_imm_values, ldr_count * sizeof(uint32_t));
+	if (sectioned) {
+		if (!write_sectioned(output, words, count + ldr_count, query(ENTRY_LABEL, dict) * 4)) {
+			fprintf(stderr, "Could not write the sectioned image\n");
+		}
+	} else {
+		fwrite(words, sizeof(uint32_t), count + ldr_count, output);
 	}
+	fclose(output);
 
+	free(words);
 	free(ldr_imm_values);
 
+	if (incremental) {
+		if (!save_cache(filename_cache, cache)) {
+			fprintf(stderr, "Could not write the reassembly cache\n");
+		}
+		free_cache(cache);
+		free(filename_cache);
+	}
+
 
 	return EXIT_SUCCESS;
 }
@@ -32,19 +32,28 @@ typedef enum {
 	MLA,
 	LDR,
 	STR,
-	BEQ,
-	BNE,
-	BGE,
-	BLT,
-	BGT,
-	BLE,
 	B,
 	LSL,
-	ANDEQ,
 	LDM,
-	STM
+	STM,
+	SWI,
+	MEMCPY,
+	MEMSET,
+	MEMCMP,
+	CHECKSUM
 } mnemonic_t;
 
+/*
+ * semihosting calls run natively by the emulator, put in the comment
+ * field of swi by the memcpy, memset, memcmp and checksum pseudo-ops
+ */
+typedef enum {
+	CALL_MEMCPY = 1,
+	CALL_MEMSET = 2,
+	CALL_MEMCMP = 3,
+	CALL_CHECKSUM = 4
+} semihost_call_t;
+
 /*
  * enum to represent the shift types
  */
@@ -62,6 +71,14 @@ typedef enum {
 typedef enum {
 	EQ = 0x0,
 	NE = 0x1,
+	CS = 0x2,
+	CC = 0x3,
+	MI = 0x4,
+	PL = 0x5,
+	VS = 0x6,
+	VC = 0x7,
+	HI = 0x8,
+	LS = 0x9,
 	GE = 0xa,
 	LT = 0xb,
 	GT = 0xc,
@@ -128,6 +145,7 @@ typedef struct {
 	uint16_t address;
 	mnemonic_t opcode;
 	bool flag;
+	bool set;               // 's' suffix: update the condition codes
 	condition_t condition;
 	union {
 		struct {
@@ -157,6 +175,9 @@ typedef struct {
 			int write_back_bit;
 			int load_store_bit;
 		} block_data_transfer;
+		struct {
+			uint32_t call;
+		} semihost;
 	} Content;
 } Token;
 
@@ -29,7 +29,8 @@
 #define UP_POS 23
 #define SHIFT_REG_POS 8
 #define SHIFT_CONST_POS 7
-#define DATA_PROC_COND_FIELD 0xe
+#define SWI_BITS 0xf
+#define SWI_COMMENT_MASK 0xffffff
 
 static void to_bits(uint32_t *binary, uint32_t input, int pos) {
 	(*binary) |= (input << pos);
@@ -48,10 +49,12 @@ void instr_to_bits(Token *token, label_dict *dict, uint16_t address, uint16_t la
 		data_transfer_to_bits(token, address, last_address, ldr_count, ldr_imm_values, binary);
 	} else if (token->opcode <= B) {
 		branch_to_bits(token, binary, dict);
-	} else if (token->opcode <= ANDEQ) {
+	} else if (token->opcode <= LSL) {
 		special_to_bits(token, binary, dict);
 	} else if(token->opcode <= STM) {
 		data_block_data_transfer_to_bits(token,binary);
+	} else if (token->opcode <= CHECKSUM) {
+		semihost_to_bits(token, binary);
 	} else {
 		exit(EXIT_FAILURE);
 	}
@@ -68,13 +71,11 @@ uint32_t rotate_right(uint32_t to_shift, uint8_t ammount) {
 
 //Data Processing instructions encoder
 void data_proc_to_bits(Token *token, uint32_t *binary) {
-	to_bits(binary, 0xe, 28);   //cond bits
 	if (token->Content.data_processing.op2.immediate) {
 		to_bits(binary, (uint32_t) 1, IMMEDIATE_POS);
 	}
 	uint32_t opcode;
 	switch (token->opcode) {
-	case ANDEQ:
 	case AND:
 		opcode = 0x0;
 		break;
@@ -113,6 +114,9 @@ void data_proc_to_bits(Token *token, uint32_t *binary) {
 	(token->opcode == TST || token->opcode == TEQ || token->opcode == CMP)
 	? to_bits(binary, 1, SET_COND_POS)
 	: to_bits(binary, (int) token->Content.data_processing.rd, RD_POS);
+	if (token->set) {
+		to_bits(binary, 1, SET_COND_POS);
+	}
 	if (token->opcode != MOV) {
 		to_bits(binary, token->Content.data_processing.rn, RN_POS);
 	}
@@ -158,6 +162,9 @@ void mul_to_bits(Token *token, uint32_t *binary) {
 	if (token->opcode == MLA) {
 		to_bits(binary, 1, ACCUMULATE_POS);             //set accumulate bit
 	}
+	if (token->set) {
+		to_bits(binary, 1, SET_COND_POS);
+	}
 }
 
 void data_block_data_transfer_to_bits(Token *token, uint32_t *binary) {
@@ -176,7 +183,6 @@ void data_block_data_transfer_to_bits(Token *token, uint32_t *binary) {
 	to_bits(binary, token->Content.block_data_transfer.up_down_bit, 23);
 	to_bits(binary, token->Content.block_data_transfer.pre_post_index, 24);
 	to_bits(binary, 1, 27);
-	to_bits(binary, token->condition, 28);
 }
 
 void data_transfer_to_bits(Token *token, uint16_t address, uint16_t last_address, uint16_t *ldr_count,
@@ -191,16 +197,16 @@ void data_transfer_to_bits(Token *token, uint16_t address, uint16_t last_address
 		if (expression <= 0xff) {
 			Token token_MOV;                                      //TOKEN FOR MOV
 			token_MOV.opcode = MOV;
+			token_MOV.set = false;
 			token_MOV.Content.data_processing.rd = token->Content.transfer.rd;
 			token_MOV.Content.data_processing.op2.immediate = 1;
 			token_MOV.Content.data_processing.op2.Register.expression
 			  = token->Content.transfer.address.Expression.expression;
 			*binary = 0;
-			to_bits(binary, AL, 28);
+			to_bits(binary, token->condition, COND_POS);
 			data_proc_to_bits(&token_MOV, binary);
 		} else {
-			uint16_t offset =
-				(last_address + *ldr_count) * 4 - address - 8;                        //PC is ahead with 8 bytes of instructions
+			uint16_t offset = literal_offset(address, last_address, *ldr_count);
 			ldr_imm_values[*ldr_count] = expression;
 			*ldr_count = *ldr_count + 1;
 			to_bits(binary, 15, RN_POS);
@@ -219,23 +225,39 @@ void data_transfer_to_bits(Token *token, uint16_t address, uint16_t last_address
 void branch_to_bits(Token *token, uint32_t *binary, label_dict *dict) {
 	to_bits(binary, 0xa, BRANCH_BITS_POS);       //for 1010 in bits 24-27 in branch instruction
 	int label_address = query(token->Content.branch.expression, dict) * 4;
-	int difference = ((int) label_address - ((int) token->address) - 8);       //-8 because of the ARM
+	to_bits(binary, branch_offset(label_address, token->address), 0);
+}
+
+//offset field of a branch at 'address' jumping to 'label_address'
+uint32_t branch_offset(int label_address, uint16_t address) {
+	int difference = (label_address - ((int) address) - 8);       //-8 because of the ARM
 	difference >>= 2;
 	difference &= 0x00ffffff;      //offset bits all 1s
-	to_bits(binary, (int32_t) difference, 0);
+	return (uint32_t) difference;
+}
+
+//offset of the 'ldr_index'-th literal, stored in the pool after the last instruction
+uint16_t literal_offset(uint16_t address, uint16_t last_address, uint16_t ldr_index) {
+	return (last_address + ldr_index) * 4 - address - 8;             //PC is ahead with 8 bytes of instructions
 }
 
 void special_to_bits(Token *token, uint32_t *binary, label_dict *dict) {
-	if (token->opcode == ANDEQ) { to_bits(binary, 0, 0); }
-	else {
-		uint32_t opcode = 0xd;           //1101
-		to_bits(binary, opcode, 21);
-		to_bits(binary, (uint32_t) token->Content.data_processing.rd, RD_POS);
-		to_bits(binary, (uint32_t) token->Content.data_processing.rd, 0);
-		to_bits(binary, (uint32_t) token->Content.data_processing.op2.Register.expression, 7);
+	uint32_t opcode = 0xd;           //1101, lsl rd,#n is mov rd,rd,lsl #n
+	to_bits(binary, opcode, 21);
+	to_bits(binary, (uint32_t) token->Content.data_processing.rd, RD_POS);
+	to_bits(binary, (uint32_t) token->Content.data_processing.rd, 0);
+	to_bits(binary, (uint32_t) token->Content.data_processing.op2.Register.expression, 7);
+	if (token->set) {
+		to_bits(binary, 1, SET_COND_POS);
 	}
 }
 
+//swi, for 1111 in bits 24-27 and the call in the comment field
+void semihost_to_bits(Token *token, uint32_t *binary) {
+	to_bits(binary, SWI_BITS, BRANCH_BITS_POS);
+	to_bits(binary, token->Content.semihost.call & SWI_COMMENT_MASK, 0);
+}
+
 void address_to_bits(Address address, uint32_t *binary) {
 	to_bits(binary, (uint32_t) address.Expression.Register.rn, RN_POS);
 	if (address.Expression.Register.format == 0) {
@@ -15,6 +15,12 @@ void branch_to_bits(Token *token, uint32_t *binary, label_dict *dict);
 
 void special_to_bits(Token *token, uint32_t *binary, label_dict *dict);
 
+void semihost_to_bits(Token *token, uint32_t *binary);
+
+uint32_t branch_offset(int label_address, uint16_t address);
+
+uint16_t literal_offset(uint16_t address, uint16_t last_address, uint16_t ldr_index);
+
 void address_to_bits(Address address, uint32_t *binary);
 
 uint32_t convert_op2(uint32_t op2);
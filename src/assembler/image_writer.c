@@ -0,0 +1,52 @@
+#include "image_writer.h"
+#include "../emulator/armemu.h"
+
+/*
+ * finds the first segment at or after word 'from', ending before a run of
+ * GAP_WORDS zero words or at 'count', whose last word is not zero
+ */
+static bool next_segment(const uint32_t *words, uint32_t count, uint32_t from,
+                         uint32_t *start, uint32_t *end) {
+	while (from < count && words[from] == 0) {
+		from++;
+	}
+	if (from == count) {
+		return false;
+	}
+	*start = from;
+	uint32_t zeros = 0;
+	for (*end = from; *end < count && zeros < GAP_WORDS; (*end)++) {
+		zeros = words[*end] ? 0 : zeros + 1;
+	}
+	*end -= zeros;
+	return true;
+}
+
+bool write_sectioned(FILE *output, const uint32_t *words, uint32_t count, uint32_t entry) {
+	uint32_t used = count;
+	while (used > 0 && words[used - 1] == 0) {
+		used--;
+	}
+
+	armemu_image_header header;
+	header.magic = ARMEMU_IMAGE_MAGIC;
+	header.entry = entry;
+	header.stack_top = 0;
+	header.stack_limit = count * sizeof(uint32_t) + 1;
+	header.bss_size = (count - used) * sizeof(uint32_t);
+	header.segment_count = 0;
+	uint32_t start, end;
+	for (end = 0; next_segment(words, used, end, &start, &end);) {
+		header.segment_count++;
+	}
+	fwrite(&header, sizeof(header), 1, output);
+
+	for (end = 0; next_segment(words, used, end, &start, &end);) {
+		armemu_image_segment segment = {start * sizeof(uint32_t), (end - start) * sizeof(uint32_t)};
+		fwrite(&segment, sizeof(segment), 1, output);
+	}
+	for (end = 0; next_segment(words, used, end, &start, &end);) {
+		fwrite(&words[start], sizeof(uint32_t), end - start, output);
+	}
+	return !ferror(output);
+}
@@ -0,0 +1,23 @@
+#ifndef AS_IMAGE_WRITER_H
+#define AS_IMAGE_WRITER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Sectioned image output (assemble -s)
+ *
+ * Writes the assembled words as a sectioned image of the emulator (see
+ * ../emulator/armemu.h) rather than a flat binary. Runs of at least
+ * GAP_WORDS zero words, such as the tables reserved with '.space', are
+ * left out of the segments, and the zero words at the end make the bss.
+ * The stack limit is the one a flat binary of the same words would get.
+ */
+
+#define GAP_WORDS 8
+
+// Returns false if writing failed.
+bool write_sectioned(FILE *output, const uint32_t *words, uint32_t count, uint32_t entry);
+
+#endif
@@ -3,12 +3,13 @@
 label_dict *new_dict() {
 	label_dict *dict = malloc(sizeof(label_dict));
 	dict->length = 0;
+	dict->labels = NULL;
 	return dict;
 }
 
 void add(const char *label, uint16_t address, label_dict *dict) {
 	dict->length++;
-	dict->labels = realloc(dict->labels, dict->length);
+	dict->labels = realloc(dict->labels, dict->length * sizeof(label_pair *));
 	label_pair *pair = malloc(sizeof(label_pair));
 	pair->address = address;
 	strcpy(pair->label, label);
@@ -8,11 +8,13 @@
 #include "parser.h"
 #include "define_types.h"
 
-static characteristics_t string_to_characteristic(const char *string);
+static bool string_to_characteristic(const char *string, characteristics_t *characteristic);
 
-static mnemonic_t string_to_mnemonic_stack(const char *string, Token *token);
+static bool string_to_condition(const char *string, condition_t *condition);
 
-static mnemonic_t string_to_mnemonic(const char *string);
+static bool parse_suffix(const char *suffix, mnemonic_t mnemonic, Token *token);
+
+static mnemonic_t parse_mnemonic(const char *string, Token *token);
 
 static shift_t string_to_shift(const char *string);
 
@@ -34,6 +36,8 @@ static void parse_transfer(Token *token, const char *string_transfer);
 
 static void parse_special(Token *token, const char *string);
 
+static void parse_semihost(Token *token, const char *string);
+
 static int parse_expression(char *expression);
 
 static char *skip_whitespace(const char *string);
@@ -42,145 +46,112 @@ static char *split(char *pointers, char separator, unsigned int number_occurrenc
 
 static char **split_and_store(char *pointers, char *separator, unsigned int number_occurrences);
 
-static characteristics_t string_to_characteristic(const char *string) {
-
-	if (!strcmp(string, "fd")) {
-		return FD;
-	}
-
-
-	if (!strcmp(string, "ed")) {
-		return ED;
-	}
-
-
-	if (!strcmp(string, "fa")) {
-		return FA;
-	}
-
+/*
+ * base mnemonics, longest first so that "b" only matches branches
+ */
+static const struct {
+	const char *name;
+	mnemonic_t mnemonic;
+} mnemonics[] = {
+	{"add", ADD}, {"sub", SUB}, {"rsb", RSB}, {"and", AND}, {"eor", EOR},
+	{"orr", ORR}, {"mov", MOV}, {"tst", TST}, {"teq", TEQ}, {"cmp", CMP},
+	{"mul", MUL}, {"mla", MLA}, {"ldr", LDR}, {"str", STR}, {"lsl", LSL},
+	{"ldm", LDM}, {"stm", STM}, {"swi", SWI}, {"memcpy", MEMCPY}, {"memset", MEMSET},
+	{"memcmp", MEMCMP}, {"checksum", CHECKSUM}, {"b", B}
+};
 
-	if (!strcmp(string, "ea")) {
-		return EA;
+/*
+ * condition suffixes, including the hs/lo aliases of cs/cc
+ */
+static const struct {
+	const char *name;
+	condition_t condition;
+} conditions[] = {
+	{"eq", EQ}, {"ne", NE}, {"cs", CS}, {"hs", CS}, {"cc", CC}, {"lo", CC},
+	{"mi", MI}, {"pl", PL}, {"vs", VS}, {"vc", VC}, {"hi", HI}, {"ls", LS},
+	{"ge", GE}, {"lt", LT}, {"gt", GT}, {"le", LE}, {"al", AL}
+};
+
+#define MNEMONICS_NUM (sizeof(mnemonics) / sizeof(mnemonics[0]))
+#define CONDITIONS_NUM (sizeof(conditions) / sizeof(conditions[0]))
+#define SUFFIX_LENGTH 2
+
+static bool string_to_characteristic(const char *string, characteristics_t *characteristic) {
+	if (!strncmp(string, "fd", SUFFIX_LENGTH)) {
+		*characteristic = FD;
+	} else if (!strncmp(string, "ed", SUFFIX_LENGTH)) {
+		*characteristic = ED;
+	} else if (!strncmp(string, "fa", SUFFIX_LENGTH)) {
+		*characteristic = FA;
+	} else if (!strncmp(string, "ea", SUFFIX_LENGTH)) {
+		*characteristic = EA;
+	} else {
+		return false;
 	}
-
-	printf("there is no corresponding enum for given string");
-	exit(EXIT_FAILURE);
+	return true;
 }
 
-static mnemonic_t string_to_mnemonic_stack(const char *string, Token *token) {
-	if (!strncmp(string, "ldm", 3)) {
-		char *string_characteristic = calloc(strlen(string) + 1, sizeof(char));
-		strncpy(string_characteristic, string + 3, 2);
-		token->Content.block_data_transfer.characteristic = string_to_characteristic(string_characteristic);
-		return LDM;
-	}
-
-	if (!strncmp(string, "stm", 3)) {
-		char *string_characteristic = calloc(strlen(string) + 1, sizeof(char));
-		strncpy(string_characteristic, string + 3, 2);
-		token->Content.block_data_transfer.characteristic = string_to_characteristic(string_characteristic);
-
-		return STM;
+static bool string_to_condition(const char *string, condition_t *condition) {
+	for (int i = 0; i < CONDITIONS_NUM; i++) {
+		if (!strncmp(string, conditions[i].name, SUFFIX_LENGTH)) {
+			*condition = conditions[i].condition;
+			return true;
+		}
 	}
-
-	printf("there is no corresponding enum for given string");
-	exit(EXIT_FAILURE);
+	return false;
 }
+
 /*
- * returns the corresponding enum of a given string_opcode
+ * parses what follows a base mnemonic:
+ * {cond}{s} or {s}{cond} for data processing and multiply,
+ * {cond} for transfers and branches,
+ * {cond}mode or mode{cond} for block transfers
  */
-static mnemonic_t string_to_mnemonic(const char *string) {
-	if (!strcmp(string, "add")) {
-		return ADD;
-	}
-
-	if (!strcmp(string, "sub")) {
-		return SUB;
-	}
-
-	if (!strcmp(string, "rsb")) {
-		return RSB;
-	}
-
-	if (!strcmp(string, "and")) {
-		return AND;
-	}
-
-	if (!strcmp(string, "eor")) {
-		return EOR;
-	}
-
-	if (!strcmp(string, "orr")) {
-		return ORR;
-	}
-
-	if (!strcmp(string, "mov")) {
-		return MOV;
-	}
-
-	if (!strcmp(string, "tst")) {
-		return TST;
-	}
-
-	if (!strcmp(string, "teq")) {
-		return TEQ;
-	}
-
-	if (!strcmp(string, "cmp")) {
-		return CMP;
-	}
-
-	if (!strcmp(string, "mul")) {
-		return MUL;
-	}
-
-	if (!strcmp(string, "mla")) {
-		return MLA;
-	}
-
-	if (!strcmp(string, "ldr")) {
-		return LDR;
-	}
-
-	if (!strcmp(string, "str")) {
-		return STR;
-	}
-	if (!strcmp(string, "beq")) {
-		return BEQ;
-	}
-	if (!strcmp(string, "bne")) {
-		return BNE;
-	}
-	if (!strcmp(string, "b")) {
-		return B;
-	}
-
-
-	if (!strcmp(string, "bge")) {
-		return BGE;
-	}
-
-	if (!strcmp(string, "blt")) {
-		return BLT;
-	}
+static bool parse_suffix(const char *suffix, mnemonic_t mnemonic, Token *token) {
+	token->condition = AL;
+	token->set = false;
 
-	if (!strcmp(string, "bgt")) {
-		return BGT;
+	if (mnemonic == LDM || mnemonic == STM) {
+		characteristics_t *characteristic = &token->Content.block_data_transfer.characteristic;
+		if (strlen(suffix) == SUFFIX_LENGTH) {
+			return string_to_characteristic(suffix, characteristic);
+		}
+		return strlen(suffix) == 2 * SUFFIX_LENGTH
+		       && ((string_to_condition(suffix, &token->condition)
+		            && string_to_characteristic(suffix + SUFFIX_LENGTH, characteristic))
+		           || (string_to_characteristic(suffix, characteristic)
+		               && string_to_condition(suffix + SUFFIX_LENGTH, &token->condition)));
 	}
 
-	if (!strcmp(string, "ble")) {
-		return BLE;
+	bool settable = mnemonic <= MLA || mnemonic == LSL;
+	if (settable && suffix[0] == 's') {
+		token->set = true;
+		suffix++;
 	}
-	if (!strcmp(string, "b")) {
-		return B;
+	if (strlen(suffix) >= SUFFIX_LENGTH) {
+		if (!string_to_condition(suffix, &token->condition)) {
+			return false;
+		}
+		suffix += SUFFIX_LENGTH;
 	}
-
-	if (!strcmp(string, "lsl")) {
-		return LSL;
+	if (settable && !token->set && !strcmp(suffix, "s")) {
+		token->set = true;
+		suffix++;
 	}
+	return suffix[0] == '\0';
+}
 
-	if (!strcmp(string, "andeq")) {
-		return ANDEQ;
+/*
+ * returns the corresponding enum of a given string_opcode, setting the
+ * condition, the 's' flag and the stack addressing mode from its suffixes
+ */
+static mnemonic_t parse_mnemonic(const char *string, Token *token) {
+	for (int i = 0; i < MNEMONICS_NUM; i++) {
+		size_t length = strlen(mnemonics[i].name);
+		if (!strncmp(string, mnemonics[i].name, length)
+		    && parse_suffix(string + length, mnemonics[i].mnemonic, token)) {
+			return mnemonics[i].mnemonic;
+		}
 	}
 	printf("there is no corresponding enum for given string");
 	exit(EXIT_FAILURE);
@@ -190,32 +161,6 @@ static mnemonic_t string_to_mnemonic(const char *string) {
 static void parse_branch(Token *token, const char *label) {
 	assert(token != NULL);
 	assert(label != NULL);
-	switch (token->opcode) {
-	case B:
-		token->condition = AL;
-		break;
-	case BEQ:
-		token->condition = EQ;
-		break;
-	case BNE:
-		token->condition = NE;
-		break;
-	case BGE:
-		token->condition = GE;
-		break;
-	case BLT:
-		token->condition = LT;
-		break;
-	case BGT:
-		token->condition = GT;
-		break;
-	case BLE:
-		token->condition = LE;
-		break;
-	default:
-		printf("Unexpected opcode");
-		exit(EXIT_FAILURE);
-	}
 	token->Content.branch.expression = (char *) label;
 }
 
@@ -315,12 +260,9 @@ static void parse_data_processing(Token *token, const char *string) {
 	case TST:
 	case TEQ:
 	case CMP:
-	case LSL:
 		operand2 = split(copy_string, ',', 1);
 		token->Content.data_processing.rn = atoi(copy_string + 1);
 		break;
-	case ANDEQ:
-		token->condition = EQ;
 	default:
 
 		operand2 = split(copy_string, ',', 2);
@@ -444,7 +386,7 @@ static void parse_transfer(Token *token, const char *string_transfer) {
 }
 
 /*
- * parses special instructions (andeq, lsl)
+ * parses special instructions (lsl)
  */
 static void parse_special(Token *token, const char *string) {
 	char *copy_string = malloc(strlen(string) + 1);
@@ -452,11 +394,37 @@ static void parse_special(Token *token, const char *string) {
 	char *operand2;
 
 	operand2 = split(copy_string, ',', 1);
-	token->Content.data_processing.rd = atoi(copy_string) + 1;
+	token->Content.data_processing.rd = atoi(copy_string + 1);
 	token->Content.data_processing.op2 = parse_operand2(operand2);
 	free(copy_string);
 }
 
+/*
+ * parses swi #call, the pseudo-ops take no operands and use r0-r2
+ */
+static void parse_semihost(Token *token, const char *string) {
+	switch (token->opcode) {
+	case MEMCPY:
+		token->Content.semihost.call = CALL_MEMCPY;
+		break;
+	case MEMSET:
+		token->Content.semihost.call = CALL_MEMSET;
+		break;
+	case MEMCMP:
+		token->Content.semihost.call = CALL_MEMCMP;
+		break;
+	case CHECKSUM:
+		token->Content.semihost.call = CALL_CHECKSUM;
+		break;
+	default: {
+		char *copy_string = calloc(strlen(string) + 1, sizeof(char));
+		strcpy(copy_string, string);
+		token->Content.semihost.call = parse_expression(copy_string + (copy_string[0] == '#'));
+		free(copy_string);
+	}
+	}
+}
+
 /*
  * parses an expression
  */
@@ -540,25 +508,15 @@ void parse_general(Token *token, char *instruction) {
 	//arguments after opcode
 	// char *args = strtok(instruction, " ");
 	char *args = split(instruction, ' ', 1);
-	mnemonic_t operation;
-	if (!strncmp(instruction, "ldm", 3) || !strncmp(instruction, "stm", 3)) {
-		operation = string_to_mnemonic_stack(instruction, token);
-	} else {
-		operation = string_to_mnemonic(instruction);
-	}
+	mnemonic_t operation = parse_mnemonic(instruction, token);
 
 	token->opcode = operation;
 	token->flag = 0;
-	token->condition = AL;
 	args = skip_whitespace(args);
 
 	if (operation == LSL) {
 		parse_special(token, args);
 
-	} else if (operation == ANDEQ) {
-		token->condition = EQ;
-		parse_special(token, args);
-
 	} else if (operation <= CMP) {
 		parse_data_processing(token, args);
 
@@ -573,12 +531,27 @@ void parse_general(Token *token, char *instruction) {
 
 	} else if (operation <= STM) {
 		parse_block_data_transfer(token, args);
+
+	} else if (operation <= CHECKSUM) {
+		parse_semihost(token, args);
 	} else {
 		printf("Error in parse_general.\n");
 		exit(EXIT_FAILURE);
 	}
 }
 
+/*
+ * recognises a '.space bytes' directive, reserving 'words' zeroed words,
+ * the bytes rounded up to a whole word
+ */
+bool parse_space(const char *line, uint32_t *words) {
+	if (strncmp(line, ".space", 6) || !isspace(line[6])) {
+		return false;
+	}
+	*words = (strtoul(&line[6], NULL, 0) + 3) / 4;
+	return true;
+}
+
 /*
  * returns a pointer to the address of the first non-whitespace character in a string
  */
@@ -11,4 +11,6 @@
 
 void parse_general(Token *token, char *instruction);
 
+bool parse_space(const char *line, uint32_t *words);
+
 #endif //ARM11_18_PARSER_H
@@ -0,0 +1,712 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "armemu.h"
+#include "define_structures.h"
+#include "emulator_processor.h"
+#include "shifter.h"
+#include "semihost.h"
+
+// --
+// -- arm2c: ahead-of-time translation of a guest image to C
+// --
+// usage: arm2c [--report=file] image output.c
+//
+// The basic blocks reachable from address 0 are found statically and each
+// is emitted as C working on the registers and CPSR as locals; a flag
+// update is only emitted when a later instruction or the final state can
+// read it. Compiled against libarmemu the output prints the same state as
+// 'emulate image':
+//
+//     cc -O2 -I src/emulator output.c src/emulator/libarmemu.a
+//
+// Anything the translation does not cover goes back to the interpreter:
+// block transfers and instructions naming r15 run one at a time through
+// execute(), and a jump out of the translated code or a store into it
+// hands the rest of the run over to armemu_run().
+//
+// --report also compiles the output, times it against emulate and writes
+// the comparison to 'file'. The compiler is $CC (default cc), the headers,
+// library and emulate are looked up next to arm2c.
+
+#define REPORT_OPTION "--report="
+#define REPORT_RUNS 5
+
+#define WORDS (MEMORY_SIZE / 4)
+#define ALL_FLAGS (N_MASK | Z_MASK | C_MASK | V_MASK)
+#define DATA_PROC_FLAGS (N_MASK | Z_MASK | C_MASK)
+#define MUL_FLAGS (N_MASK | Z_MASK)
+
+struct Translation {
+	Machine *arm;            // holds the image, decodes through predecode()
+	uint32_t entry;          // first instruction, 0 unless a sectioned image says
+	bool reachable[WORDS];
+	bool leader[WORDS];      // first instruction of a basic block
+	uint32_t code_end;       // stores below this may rewrite translated code
+	uint32_t instructions;
+	uint32_t blocks;
+	uint32_t elided;         // flag updates left out
+	FILE *out;
+
+	// parts of the program the blocks refer to
+	bool uses_dispatch;
+	bool uses_interpret;
+	bool uses_halt;
+};
+typedef struct Translation Translation;
+
+// C condition on the local 'cpsr' for each cond field
+
+static const char *conditions[16] = {
+	[eq] = "cpsr & Z_MASK",
+	[ne] = "!(cpsr & Z_MASK)",
+	[cs] = "cpsr & C_MASK",
+	[cc] = "!(cpsr & C_MASK)",
+	[mi] = "cpsr & N_MASK",
+	[pl] = "!(cpsr & N_MASK)",
+	[vs] = "cpsr & V_MASK",
+	[vc] = "!(cpsr & V_MASK)",
+	[hi] = "(cpsr & C_MASK) && !(cpsr & Z_MASK)",
+	[ls] = "!(cpsr & C_MASK) || (cpsr & Z_MASK)",
+	[ge] = "!(cpsr & N_MASK) == !(cpsr & V_MASK)",
+	[lt] = "!(cpsr & N_MASK) != !(cpsr & V_MASK)",
+	[gt] = "!(cpsr & Z_MASK) && !(cpsr & N_MASK) == !(cpsr & V_MASK)",
+	[le] = "(cpsr & Z_MASK) || !(cpsr & N_MASK) != !(cpsr & V_MASK)",
+	[al] = "1",
+	[nv] = "0"
+};
+
+static Decoded_Instr *instr_at(Translation *t, uint32_t address) {
+	return predecode(t->arm, address);
+}
+
+static bool in_memory(uint32_t address) {
+	return address <= MEMORY_SIZE - sizeof(uint32_t);
+}
+
+static uint32_t branch_target(Decoded_Instr *instr, uint32_t address) {
+	return address + PIPELINE_OFFSET + instr->operand.sgn_offset;
+}
+
+// --
+// -- Block discovery
+// --
+
+static void discover(Translation *t) {
+	uint32_t *work = malloc(WORDS * sizeof(uint32_t));
+	uint32_t pending = 0;
+	work[pending++] = t->entry;
+	t->leader[t->entry / 4] = true;
+
+	while (pending) {
+		uint32_t address = work[--pending];
+		while (in_memory(address) && !t->reachable[address / 4]) {
+			t->reachable[address / 4] = true;
+			t->instructions++;
+			Decoded_Instr *instr = instr_at(t, address);
+			if (instr->type == HALT) {
+				break;
+			}
+			if (instr->type == BRANCH) {
+				uint32_t target = branch_target(instr, address);
+				if (in_memory(target)) {
+					t->leader[target / 4] = true;
+					work[pending++] = target;
+				}
+				if (!instr->conditional) {
+					break;
+				}
+				if (in_memory(address + 4)) {
+					t->leader[address / 4 + 1] = true;
+				}
+			}
+			address += 4;
+		}
+	}
+	free(work);
+
+	for (uint32_t w = 0; w < WORDS; w++) {
+		if (t->reachable[w]) {
+			t->code_end = (w + 1) * 4;
+			t->blocks += t->leader[w];
+		}
+	}
+}
+
+// --
+// -- Emission
+// --
+
+// Instructions left to execute() one at a time
+
+static bool needs_interpreter(Decoded_Instr *instr) {
+	uint32_t operand = instr->operand.op2;
+	bool shifted_reg = false;
+	bool uses_pc = false;
+	switch (instr->type) {
+	case DATA_PROC:
+		shifted_reg = !instr->imm;
+		uses_pc = instr->rn == PC_REG || instr->rd == PC_REG;
+		switch (instr->opcode) {
+		case OPCODE_AND: case OPCODE_EOR: case OPCODE_SUB: case OPCODE_RSB: case OPCODE_ADD:
+		case OPCODE_TST: case OPCODE_TEQ: case OPCODE_CMP: case OPCODE_ORR: case OPCODE_MOV:
+			break;
+		default:
+			return true;
+		}
+		break;
+	case MUL:
+		return instr->rd == PC_REG || (instr->accum && instr->rn == PC_REG)
+		       || instr->operand.mul.rm == PC_REG || instr->operand.mul.rs == PC_REG;
+	case TRANSFER:
+		operand = instr->operand.offset;
+		shifted_reg = instr->imm;
+		uses_pc = instr->rd == PC_REG || (instr->rn == PC_REG && !instr->pre_index);
+		break;
+	case MULTI_TRANSFER:
+	case SEMIHOST:
+		return true;
+	default:
+		return false;
+	}
+	if (shifted_reg) {
+		uint32_t shift = (operand & SHIFT_MASK) >> 4;
+		uses_pc |= (operand & RM_MASK) == PC_REG || ((shift & 1) && ((0xf << 4) & shift) >> 4 == PC_REG);
+	}
+	return uses_pc;
+}
+
+// Flags the instruction sets, if it runs
+static uint32_t flags_set(Decoded_Instr *instr) {
+	if (instr->type == DATA_PROC && instr->set && !needs_interpreter(instr)) {
+		switch (instr->opcode) {
+		case OPCODE_SUB:
+		case OPCODE_RSB:
+		case OPCODE_ADD:
+		case OPCODE_CMP:
+			return ALL_FLAGS;
+		default:
+			return DATA_PROC_FLAGS;
+		}
+	}
+	if (instr->type == MUL && instr->set && !needs_interpreter(instr)) {
+		return MUL_FLAGS;
+	}
+	return 0;
+}
+
+// Flags the instruction may read other than through its condition: the
+// shifter carry starts as C
+static uint32_t flags_read(Decoded_Instr *instr) {
+	if (instr->type == DATA_PROC && !(instr->imm && instr->accum)) {
+		return C_MASK;
+	}
+	if (instr->type == TRANSFER && instr->imm) {
+		return C_MASK;
+	}
+	return 0;
+}
+
+// Points where the interpreter may take over need the real CPSR
+static bool spills(Decoded_Instr *instr) {
+	return instr->type == HALT || needs_interpreter(instr) || (instr->type == TRANSFER && !instr->load);
+}
+
+static void emit(Translation *t, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	vfprintf(t->out, format, args);
+	va_end(args);
+}
+
+// The shifter carry starts as the C flag, a rotated immediate's being its bit 31
+static void emit_operand2(Translation *t, uint32_t operand, bool imm, bool rotated) {
+	if (imm && rotated) {
+		emit(t, "\t\top2 = 0x%08xu;\n\t\tcarry = %u;\n", operand, operand >> 31);
+		return;
+	}
+	emit(t, "\t\tcarry = (cpsr & C_MASK) != 0;\n");
+	if (imm) {
+		emit(t, "\t\top2 = 0x%08xu;\n", operand);
+	} else if (operand & SHIFT_BY_REGISTER) {
+		emit(t, "\t\top2 = shift_operand(0x%03xu, r%u, r%u, &carry);\n", operand, operand & RM_MASK,
+		     shift_register(operand));
+	} else {
+		emit(t, "\t\top2 = shift_operand(0x%03xu, r%u, 0, &carry);\n", operand, operand & RM_MASK);
+	}
+}
+
+static void emit_data_process(Translation *t, Decoded_Instr *instr, bool flags) {
+	const char *carry = "carry";
+	const char *overflow = NULL;    // in the sign bit, arithmetic only
+	char op1[8];
+	sprintf(op1, "r%u", instr->rn);
+	emit_operand2(t, instr->operand.op2, instr->imm, instr->accum);
+	switch (instr->opcode) {
+	case OPCODE_AND:
+	case OPCODE_TST:
+		emit(t, "\t\tres = %s & op2;\n", op1);
+		break;
+	case OPCODE_EOR:
+	case OPCODE_TEQ:
+		emit(t, "\t\tres = %s ^ op2;\n", op1);
+		break;
+	case OPCODE_SUB:
+	case OPCODE_CMP:
+		emit(t, "\t\tres = %s - op2;\n", op1);
+		carry = "r%u >= op2";
+		overflow = "(r%u ^ op2) & (r%u ^ res)";
+		break;
+	case OPCODE_RSB:
+		emit(t, "\t\tres = op2 - %s;\n", op1);
+		carry = "op2 >= r%u";
+		overflow = "(op2 ^ r%u) & (op2 ^ res)";
+		break;
+	case OPCODE_ADD:
+		emit(t, "\t\tres = %s + op2;\n", op1);
+		carry = "res < r%u";
+		overflow = "~(r%u ^ op2) & (r%u ^ res)";
+		break;
+	case OPCODE_ORR:
+		emit(t, "\t\tres = %s | op2;\n", op1);
+		break;
+	case OPCODE_MOV:
+		emit(t, "\t\tres = op2;\n");
+		break;
+	}
+	if (flags) {
+		char c[32];
+		char v[48];
+		sprintf(c, carry, instr->rn);
+		if (overflow) {
+			sprintf(v, overflow, instr->rn, instr->rn);
+			emit(t, "\t\tcpsr = (cpsr & ~(N_MASK | Z_MASK | C_MASK | V_MASK)) | (res & N_MASK)"
+			        " | (res ? 0 : Z_MASK) | (%s ? C_MASK : 0) | ((%s) & N_MASK ? V_MASK : 0);\n", c, v);
+		} else {
+			emit(t, "\t\tcpsr = (cpsr & ~(N_MASK | Z_MASK | C_MASK)) | (res & N_MASK) | (res ? 0 : Z_MASK)"
+			        " | (%s ? C_MASK : 0);\n", c);
+		}
+	}
+	if (instr->opcode != OPCODE_TST && instr->opcode != OPCODE_TEQ && instr->opcode != OPCODE_CMP) {
+		emit(t, "\t\tr%u = res;\n", instr->rd);
+	}
+}
+
+static void emit_multiply(Translation *t, Decoded_Instr *instr, bool flags) {
+	emit(t, "\t\tres = r%u * r%u", instr->operand.mul.rm, instr->operand.mul.rs);
+	if (instr->accum) {
+		emit(t, " + r%u", instr->rn);
+	}
+	emit(t, ";\n");
+	if (flags) {
+		emit(t, "\t\tcpsr = (cpsr & ~(N_MASK | Z_MASK)) | (res & N_MASK) | (res ? 0 : Z_MASK);\n");
+	}
+	emit(t, "\t\tr%u = res;\n", instr->rd);
+}
+
+static void emit_transfer(Translation *t, Decoded_Instr *instr, uint32_t address) {
+	char base[16];
+	char offset[24];
+	if (instr->rn == PC_REG) {
+		sprintf(base, "0x%08xu", address + PIPELINE_OFFSET);
+	} else {
+		sprintf(base, "r%u", instr->rn);
+	}
+	if (!instr->imm) {
+		uint32_t value = instr->up ? instr->operand.offset : -instr->operand.offset;
+		sprintf(offset, "0x%08xu", value);
+	} else {
+		emit_operand2(t, instr->operand.offset, false, false);
+		sprintf(offset, instr->up ? "op2" : "-op2");
+	}
+	if (instr->pre_index) {
+		emit(t, "\t\taddress = %s + %s;\n", base, offset);
+	} else {
+		emit(t, "\t\taddress = %s;\n\t\t%s += %s;\n", base, base, offset);
+	}
+
+	emit(t, "\t\tif (address > MEMORY_SIZE - 4) {\n");
+	emit(t, "\t\t\tvalue = r%u;\n", instr->rd);
+	emit(t, "\t\t\tif (!mmio_transfer(arm, address, %s, &value)) {\n", instr->load ? "true" : "false");
+	emit(t, "\t\t\t\tout_of_bounds(arm, address);\n");
+	if (instr->load) {
+		emit(t, "\t\t\t} else {\n\t\t\t\tr%u = value;\n", instr->rd);
+	}
+	emit(t, "\t\t\t}\n");
+	if (instr->load) {
+		emit(t, "\t\t} else {\n\t\t\tmemcpy(&r%u, &arm->memory[address], 4);\n\t\t}\n", instr->rd);
+	} else {
+		emit(t, "\t\t} else {\n\t\t\tmemcpy(&arm->memory[address], &r%u, 4);\n", instr->rd);
+		emit(t, "\t\t\tif (address < CODE_END) {\n\t\t\t\tnext = 0x%08xu;\n\t\t\t\tgoto interpret;\n\t\t\t}\n\t\t}\n",
+		     address + 4);
+		t->uses_interpret = true;
+	}
+}
+
+static void emit_interpreted(Translation *t, Decoded_Instr *instr, uint32_t address) {
+	bool copies = instr->type == SEMIHOST
+	              && (instr->operand.call == SEMIHOST_MEMCPY || instr->operand.call == SEMIHOST_MEMSET);
+	bool stores = (instr->type == MULTI_TRANSFER && !instr->load) || copies;
+	if (copies) {
+		emit(t, "\t\taddress = r0;\n");
+	} else if (stores) {
+		// lowest word a block store may write
+		uint8_t num = 0;
+		for (uint16_t list = instr->operand.register_list; list; list >>= 1) {
+			num += list & 1;
+		}
+		emit(t, "\t\taddress = r%u - %u;\n", instr->rn, instr->up ? 0 : 4 * num);
+	}
+	emit(t, "\t\tSPILL();\n\t\tarm->pc_reg = 0x%08xu;\n", address + PIPELINE_OFFSET);
+	emit(t, "\t\texecute(predecode(arm, 0x%08xu), arm, arm->data_proc_func);\n", address);
+	emit(t, "\t\tRELOAD();\n");
+	emit(t, "\t\tif (arm->end) {\n\t\t\tpc = 0x%08xu;\n\t\t\tgoto halt;\n\t\t}\n", address + PIPELINE_OFFSET);
+	t->uses_halt = true;
+	if (stores) {
+		emit(t, "\t\tif (address < CODE_END) {\n\t\t\tnext = 0x%08xu;\n\t\t\tgoto interpret;\n\t\t}\n", address + 4);
+		t->uses_interpret = true;
+	}
+	if (instr->type == MULTI_TRANSFER && instr->load && instr->operand.register_list & (1 << PC_REG)) {
+		// loaded the PC: carry on from wherever it points
+		emit(t, "\t\tif (arm->branch_executed) {\n\t\t\tarm->branch_executed = false;\n");
+		emit(t, "\t\t\tnext = arm->pc_reg;\n\t\t\tgoto dispatch;\n\t\t}\n");
+		t->uses_dispatch = true;
+	}
+}
+
+// Jump to a block, or through the dispatcher if it was not translated
+static void emit_jump(Translation *t, uint32_t target, const char *indent) {
+	if (in_memory(target) && t->leader[target / 4]) {
+		emit(t, "%sgoto b_%08x;\n", indent, target);
+	} else {
+		emit(t, "%snext = 0x%08xu;\n%sgoto dispatch;\n", indent, target, indent);
+		t->uses_dispatch = true;
+	}
+}
+
+static void emit_block(Translation *t, uint32_t start) {
+	uint32_t end = start;
+	while (true) {
+		Decoded_Instr *instr = instr_at(t, end);
+		end += 4;
+		if (instr->type == HALT || instr->type == BRANCH || !in_memory(end) || t->leader[end / 4]) {
+			break;
+		}
+	}
+
+	// flag liveness, walking the block backwards from a live CPSR
+	uint32_t count = (end - start) / 4;
+	bool *flags = malloc(count * sizeof(bool));
+	uint32_t live = ALL_FLAGS;
+	for (uint32_t i = count; i-- > 0;) {
+		Decoded_Instr *instr = instr_at(t, start + 4 * i);
+		uint32_t set = flags_set(instr);
+		flags[i] = (live & set) != 0;
+		if (set && !flags[i]) {
+			t->elided++;
+		}
+		if (instr->conditional || spills(instr)) {
+			live = ALL_FLAGS;
+		} else {
+			live = (live & ~set) | flags_read(instr);
+		}
+	}
+
+	emit(t, "b_%08x:\n", start);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t address = start + 4 * i;
+		Decoded_Instr *instr = instr_at(t, address);
+		emit(t, "\tsteps++;\n");
+		if (instr->type == HALT) {
+			emit(t, "\tpc = 0x%08xu;\n\tgoto halt;\n", address + PIPELINE_OFFSET);
+			t->uses_halt = true;
+			break;
+		}
+		if (instr->type == BRANCH) {
+			uint32_t target = branch_target(instr, address);
+			if (instr->conditional) {
+				emit(t, "\tif (%s) {\n", conditions[instr->cond]);
+				emit_jump(t, target, "\t\t");
+				emit(t, "\t}\n");
+				emit_jump(t, address + 4, "\t");
+			} else {
+				emit_jump(t, target, "\t");
+			}
+			break;
+		}
+		if (instr->type == NOOP) {
+			continue;
+		}
+		if (needs_interpreter(instr)) {
+			emit(t, "\t{\n");
+			emit_interpreted(t, instr, address);
+			emit(t, "\t}\n");
+			continue;
+		}
+		emit(t, "\tif (%s) {\n", instr->conditional ? conditions[instr->cond] : "1");
+		switch (instr->type) {
+		case DATA_PROC:
+			emit_data_process(t, instr, flags[i]);
+			break;
+		case MUL:
+			emit_multiply(t, instr, flags[i]);
+			break;
+		case TRANSFER:
+			emit_transfer(t, instr, address);
+			break;
+		default:
+			break;
+		}
+		emit(t, "\t}\n");
+	}
+	Decoded_Instr *last = instr_at(t, end - 4);
+	if (last->type != HALT && last->type != BRANCH) {
+		emit_jump(t, end, "\t");
+	}
+	free(flags);
+}
+
+// The blocks are written first, to a temporary file, so that only the
+// parts of the program they refer to are emitted around them.
+
+static void emit_program(Translation *t, const char *name, const uint8_t *image, size_t size, bool stack_mode) {
+	FILE *out = t->out;
+	FILE *body = tmpfile();
+	if (body == NULL) {
+		fprintf(stderr, "Could not create a temporary file");
+		exit(EXIT_FAILURE);
+	}
+	t->out = body;
+	for (uint32_t w = 0; w < WORDS; w++) {
+		if (t->reachable[w] && t->leader[w]) {
+			emit_block(t, w * 4);
+			emit(t, "\n");
+		}
+	}
+	t->out = out;
+
+	emit(t, "// Translated by arm2c from %s, do not edit\n\n", name);
+	emit(t, "#include <stdlib.h>\n#include <stdio.h>\n#include <string.h>\n\n");
+	emit(t, "#include \"armemu.h\"\n#include \"define_structures.h\"\n#include \"emulator_processor.h\"\n");
+	emit(t, "#include \"decode_helpers.h\"\n#include \"shifter.h\"\n#include \"gpio.h\"\n\n");
+	emit(t, "#define STACK_MODE %s\n#define CODE_END 0x%08xu\n\n", stack_mode ? "true" : "false", t->code_end);
+
+	emit(t, "static const uint8_t image[%zu] = {", size ? size : 1);
+	for (size_t i = 0; i < size || i == 0; i++) {
+		emit(t, "%s0x%02x,", i % 12 ? " " : "\n\t", i < size ? image[i] : 0);
+	}
+	emit(t, "\n};\n\n");
+
+	emit(t, "#define SPILL() do { \\\n");
+	for (int r = 0; r < GENERAL_REGISTERS_NUM; r++) {
+		emit(t, "\tarm->general_reg[%d] = r%d; \\\n", r, r);
+	}
+	emit(t, "\tarm->cpsr_reg = cpsr; arm->shifter_carry = carry; arm->steps = steps; \\\n} while (0)\n\n");
+	emit(t, "#define RELOAD() do { \\\n");
+	for (int r = 0; r < GENERAL_REGISTERS_NUM; r++) {
+		emit(t, "\tr%d = arm->general_reg[%d]; \\\n", r, r);
+	}
+	emit(t, "\tcpsr = arm->cpsr_reg; carry = arm->shifter_carry; \\\n} while (0)\n\n");
+
+	emit(t, "int main(void) {\n");
+	emit(t, "\tMachine *arm = armemu_create();\n");
+	emit(t, "\tif (arm == NULL || !armemu_load(arm, image, %zu)) {\n", size);
+	emit(t, "\t\tfprintf(stderr, \"Could not allocate the machine\");\n\t\texit(EXIT_FAILURE);\n\t}\n");
+	emit(t, "\tarm->report_errors = true;\n\tGpio gpio;\n\tgpio_attach(&gpio, arm, stdout);\n\n");
+	emit(t, "\tuint32_t");
+	for (int r = 0; r < GENERAL_REGISTERS_NUM; r++) {
+		emit(t, " r%d,", r);
+	}
+	emit(t, " cpsr;\n\tuint8_t carry;\n\tuint64_t steps = 0;\n");
+	emit(t, "\tuint32_t op2 = 0, res = 0, address = 0, value = 0, pc = 0, next = 0;\n");
+	emit(t, "\tRELOAD();\n\tgoto b_%08x;\n\n", t->entry);
+
+	rewind(body);
+	char buffer[1 << 12];
+	size_t got;
+	while ((got = fread(buffer, 1, sizeof(buffer), body))) {
+		fwrite(buffer, 1, got, out);
+	}
+	fclose(body);
+
+	bool interpreter = t->uses_dispatch || t->uses_interpret;
+	if (t->uses_dispatch) {
+		emit(t, "dispatch:\n\tswitch (next) {\n");
+		for (uint32_t w = 0; w < WORDS; w++) {
+			if (t->reachable[w] && t->leader[w]) {
+				emit(t, "\tcase 0x%08xu:\n\t\tgoto b_%08x;\n", w * 4, w * 4);
+			}
+		}
+		emit(t, "\tdefault:\n\t\tbreak;\n\t}\n\n");
+	}
+	if (interpreter) {
+		emit(t, "%s\tSPILL();\n\tarm->pc_reg = next + PIPELINE_OFFSET;\n\tarmemu_run(arm);\n\tgoto finish;\n\n",
+		     t->uses_interpret ? "interpret:\n" : "");
+	}
+	if (t->uses_halt) {
+		emit(t, "halt:\n\tSPILL();\n\tarm->pc_reg = pc;\n\tarm->end = true;\n\n");
+	}
+	emit(t, "%s\tgpio_flush(&gpio);\n", interpreter ? "finish:\n" : "");
+	emit(t, "\tswitch (arm->fault) {\n\tcase ARMEMU_PC_OUT_OF_RANGE:\n");
+	emit(t, "\t\tfprintf(stderr, \"PC exceeded memory size\");\n\t\texit(EXIT_FAILURE);\n");
+	emit(t, "\tcase ARMEMU_STACK_LIMIT:\n");
+	emit(t, "\t\tfprintf(stderr, \"Error: Illegal memory access: stack limit exceeded\");\n\t\texit(EXIT_FAILURE);\n");
+	emit(t, "\tdefault:\n\t\tbreak;\n\t}\n");
+	emit(t, "\tprint_machine_status(arm, STACK_MODE);\n");
+	emit(t, "\t(void) op2;\n\t(void) res;\n\t(void) address;\n\t(void) value;\n\t(void) pc;\n\t(void) next;\n");
+	emit(t, "\tarmemu_destroy(arm);\n\treturn EXIT_SUCCESS;\n}\n");
+}
+
+// --
+// -- Timing report
+// --
+
+static double now_ms(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000.0 + now.tv_nsec / 1e6;
+}
+
+// Best wall time of REPORT_RUNS runs of 'command', its output kept in 'output'
+static double time_command(const char *command, char **output, size_t *length) {
+	double best = -1;
+	for (int run = 0; run < REPORT_RUNS; run++) {
+		double start = now_ms();
+		FILE *pipe = popen(command, "r");
+		if (pipe == NULL) {
+			return -1;
+		}
+		char *buffer = NULL;
+		size_t size = 0;
+		size_t used = 0;
+		size_t got;
+		do {
+			if (used == size) {
+				size = size ? 2 * size : 1 << 16;
+				buffer = realloc(buffer, size);
+			}
+			got = fread(buffer + used, 1, size - used, pipe);
+			used += got;
+		} while (got);
+		pclose(pipe);
+		double elapsed = now_ms() - start;
+		if (best < 0 || elapsed < best) {
+			best = elapsed;
+		}
+		free(*output);
+		*output = buffer;
+		*length = used;
+	}
+	return best;
+}
+
+static void write_report(Translation *t, const char *report, const char *tool, const char *image, const char *source) {
+	char dir[1024] = ".";
+	const char *slash = strrchr(tool, '/');
+	if (slash != NULL) {
+		snprintf(dir, sizeof(dir), "%.*s", (int) (slash - tool), tool);
+	}
+	const char *cc = getenv("CC") ? getenv("CC") : "cc";
+
+	char native[1100];
+	char command[4096];
+	snprintf(native, sizeof(native), "%s.native", source);
+	snprintf(command, sizeof(command), "%s -O2 -I%s -o %s %s %s/libarmemu.a", cc, dir, native, source, dir);
+	if (system(command)) {
+		fprintf(stderr, "Could not compile %s", source);
+		exit(EXIT_FAILURE);
+	}
+
+	char *emulated_out = NULL;
+	char *native_out = NULL;
+	size_t emulated_len = 0;
+	size_t native_len = 0;
+	snprintf(command, sizeof(command), "%s/emulate %s 2>&1", dir, image);
+	double emulated = time_command(command, &emulated_out, &emulated_len);
+	snprintf(command, sizeof(command), "./%s 2>&1", native);
+	if (native[0] == '/') {
+		snprintf(command, sizeof(command), "%s 2>&1", native);
+	}
+	double translated = time_command(command, &native_out, &native_len);
+	bool same = emulated_len == native_len && !memcmp(emulated_out, native_out, native_len);
+
+	FILE *out = fopen(report, "w");
+	if (out == NULL) {
+		fprintf(stderr, "Could not write %s", report);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(out, "arm2c report for %s\n", image);
+	fprintf(out, "translated:   %u instructions in %u blocks, %u flag updates elided\n",
+	        t->instructions, t->blocks, t->elided);
+	fprintf(out, "emulate:      %.2f ms (best of %d)\n", emulated, REPORT_RUNS);
+	fprintf(out, "native:       %.2f ms (best of %d)\n", translated, REPORT_RUNS);
+	fprintf(out, "speedup:      %.2fx\n", translated > 0 ? emulated / translated : 0);
+	fprintf(out, "output:       %s\n", same ? "identical" : "DIFFERENT");
+	fclose(out);
+	free(emulated_out);
+	free(native_out);
+}
+
+int main(int argc, char **argv) {
+	const char *report = NULL;
+	const char *files[2];
+	int file_count = 0;
+	for (int i = 1; i < argc; i++) {
+		if (!strncmp(argv[i], REPORT_OPTION, strlen(REPORT_OPTION))) {
+			report = argv[i] + strlen(REPORT_OPTION);
+		} else if (file_count < 2) {
+			files[file_count++] = argv[i];
+		} else {
+			file_count = 3;
+			break;
+		}
+	}
+	if (file_count != 2) {
+		fprintf(stderr, "usage: arm2c [--report=file] image output.c");
+		exit(EXIT_FAILURE);
+	}
+
+	FILE *input = fopen(files[0], "rb");
+	if (input == NULL) {
+		fprintf(stderr, "File could not be found");
+		exit(EXIT_FAILURE);
+	}
+	uint8_t *image = malloc(MEMORY_SIZE);
+	size_t image_size = fread(image, 1, MEMORY_SIZE, input);
+	fclose(input);
+
+	// same rule as emulate
+	int n = strlen(files[0]);
+	bool stack_mode = n >= 7 && strncmp("stack", &files[0][n - 7], 5) == 0;
+
+	Translation *t = calloc(1, sizeof(Translation));
+	t->arm = armemu_create();
+	if (t->arm == NULL || !armemu_load(t->arm, image, image_size)) {
+		fprintf(stderr, "Instructions exceeded memory size");
+		exit(EXIT_FAILURE);
+	}
+	t->entry = armemu_pc(t->arm) - PIPELINE_OFFSET;
+	discover(t);
+
+	t->out = fopen(files[1], "w");
+	if (t->out == NULL) {
+		fprintf(stderr, "Could not write %s", files[1]);
+		exit(EXIT_FAILURE);
+	}
+	emit_program(t, files[0], image, image_size, stack_mode);
+	fclose(t->out);
+
+	if (report != NULL) {
+		write_report(t, report, argv[0], files[0], files[1]);
+	}
+
+	armemu_destroy(t->arm);
+	free(t);
+	free(image);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,617 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "armemu.h"
+#include "emulator_processor.h"
+#include "fusion.h"
+#include "timing.h"
+#include "host_perf.h"
+#include "fuzz.h"
+#include "define_structures.h"
+
+// --
+// -- Machine lifetime
+// --
+
+// Blocks at least this large are aligned to it and advised onto
+// transparent huge pages, a TLB entry for 2 MiB of machines
+
+#define HUGE_PAGE_SIZE (2u << 20)
+
+size_t armemu_machine_size(void) {
+	return (sizeof(Machine) + ARMEMU_MACHINE_ALIGN - 1) / ARMEMU_MACHINE_ALIGN * ARMEMU_MACHINE_ALIGN;
+}
+
+void *armemu_alloc_machines(size_t count) {
+	if (count > SIZE_MAX / armemu_machine_size()) {
+		return NULL;
+	}
+	size_t size = count * armemu_machine_size();
+	size_t align = ARMEMU_MACHINE_ALIGN;
+	if (size >= HUGE_PAGE_SIZE) {
+		align = HUGE_PAGE_SIZE;
+		size = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+	}
+	void *storage;
+	if (posix_memalign(&storage, align, size)) {
+		return NULL;
+	}
+#ifdef MADV_HUGEPAGE
+	if (align == HUGE_PAGE_SIZE) {
+		// only advice: without huge pages the block is used as it is
+		madvise(storage, size, MADV_HUGEPAGE);
+	}
+#endif
+	return storage;
+}
+
+armemu_machine *armemu_init(void *storage) {
+	Machine *arm = storage;
+	arm->mmio_count = 0;
+	arm->breakpoint_count = 0;
+	arm->watchpoint_count = 0;
+	arm->trapped_pages = 0;
+	arm->fusion = true;
+#ifdef ARMEMU_TIMING
+	arm->timing = NULL;
+#endif
+#ifdef ARMEMU_HOST_PERF
+	arm->host_perf = NULL;
+#endif
+#ifdef ARMEMU_FUZZ
+	arm->fuzz = NULL;
+#endif
+#ifdef ARMEMU_REVERSE
+	arm->reverse = NULL;
+#endif
+	armemu_reset(arm);
+	arm->end = true;
+	return arm;
+}
+
+armemu_machine *armemu_create(void) {
+	void *storage = armemu_alloc_machines(1);
+	if (storage == NULL) {
+		return NULL;
+	}
+	return armemu_init(storage);
+}
+
+void armemu_destroy(armemu_machine *arm) {
+	free(arm);
+}
+
+// Everything but guest memory and the decode cache
+
+static void reset_registers(Machine *arm) {
+	memset(arm->general_reg, 0, GENERAL_REGISTERS_NUM * sizeof(uint32_t));
+
+	arm->cpsr_reg = 0;
+	arm->pc_reg = PIPELINE_OFFSET;  // the pipeline starts out full
+	arm->end = false;
+	arm->branch_executed = false;
+	arm->shifter_carry = 0;
+	arm->general_reg[SP_REG] = MEMORY_SIZE;
+	arm->stack_limit = 0;
+
+	init_data_proc_func(arm->data_proc_func);
+	arm->steps = 0;
+	memset(arm->fusion_hits, 0, sizeof(arm->fusion_hits));
+
+	arm->fault = ARMEMU_OK;
+	arm->fault_addr = 0;
+	arm->report_errors = false;
+}
+
+void armemu_reset(armemu_machine *arm) {
+	memset(arm->memory, 0, MEMORY_SIZE * sizeof(uint8_t));
+	memset(arm->predecoded, 0, sizeof(arm->predecoded));
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		tag_breakpoint(arm, arm->breakpoints[i]);
+	}
+	reset_registers(arm);
+}
+
+// A write from the host, loading an image or through armemu_memory(), is
+// not a guest store: it drops the decoded instructions and keeps
+// breakpoints, but trips no watchpoint and dirties no page
+
+static void host_write(Machine *arm, uint32_t address);
+
+// A sectioned image is told from a flat one by its magic
+
+static bool is_sectioned(const uint8_t *image, size_t length) {
+	uint32_t magic;
+	if (length < sizeof(armemu_image_header)) {
+		return false;
+	}
+	memcpy(&magic, image, sizeof(uint32_t));
+	return magic == ARMEMU_IMAGE_MAGIC;
+}
+
+static armemu_image_segment image_segment(const uint8_t *image, uint32_t index) {
+	armemu_image_segment segment;
+	memcpy(&segment, &image[sizeof(armemu_image_header) + index * sizeof(segment)], sizeof(segment));
+	return segment;
+}
+
+// Whether the image fits in guest memory and, if sectioned, its segments
+// are in order and within the image, before any of it is written
+
+static enum armemu_fault check_image(const uint8_t *image, size_t length) {
+	if (length >= MEMORY_SIZE) {
+		return ARMEMU_IMAGE_TOO_LARGE;
+	}
+	if (!is_sectioned(image, length)) {
+		return ARMEMU_OK;
+	}
+	armemu_image_header header;
+	memcpy(&header, image, sizeof(header));
+	if (header.segment_count > (length - sizeof(header)) / sizeof(armemu_image_segment)) {
+		return ARMEMU_BAD_IMAGE;
+	}
+	size_t data = sizeof(header) + header.segment_count * sizeof(armemu_image_segment);
+	uint32_t end = 0;
+	for (uint32_t i = 0; i < header.segment_count; i++) {
+		armemu_image_segment segment = image_segment(image, i);
+		if (segment.address % 4 || segment.size % 4 || segment.address < end
+		    || segment.size > length - data) {
+			return ARMEMU_BAD_IMAGE;
+		}
+		if (segment.address > MEMORY_SIZE - segment.size) {
+			return ARMEMU_IMAGE_TOO_LARGE;
+		}
+		data += segment.size;
+		end = segment.address + segment.size;
+	}
+	if (header.bss_size > MEMORY_SIZE - end) {
+		return ARMEMU_IMAGE_TOO_LARGE;
+	}
+	if (header.entry % 4 || header.entry >= MEMORY_SIZE || header.stack_top > MEMORY_SIZE
+	    || header.stack_top % 4) {
+		return ARMEMU_BAD_IMAGE;
+	}
+	return ARMEMU_OK;
+}
+
+// Guest memory is compared with the image a block at a time, and only
+// the words that differ in differing blocks are written and have their
+// decoded instruction dropped.
+
+#define RELOAD_BLOCK_SIZE 256
+
+static const uint8_t zero_block[RELOAD_BLOCK_SIZE];
+
+// Make the 'length' bytes of guest memory at 'address', both word aligned,
+// hold 'want', or zeros if NULL
+
+static void reload_range(Machine *arm, uint32_t address, const uint8_t *want, uint32_t length) {
+	for (uint32_t done = 0; done < length; done += RELOAD_BLOCK_SIZE) {
+		uint32_t size = length - done < RELOAD_BLOCK_SIZE ? length - done : RELOAD_BLOCK_SIZE;
+		const uint8_t *block = want != NULL ? &want[done] : zero_block;
+		uint8_t *memory = &arm->memory[address + done];
+		if (!memcmp(memory, block, size)) {
+			continue;
+		}
+		for (uint32_t i = 0; i < size; i += sizeof(uint32_t)) {
+			if (memcmp(&memory[i], &block[i], sizeof(uint32_t))) {
+				memcpy(&memory[i], &block[i], sizeof(uint32_t));
+				host_write(arm, address + done + i);
+			}
+		}
+	}
+}
+
+// Copy the segments of a checked sectioned image, or with 'reload' make
+// guest memory match it, zeros included, and start the machine as the
+// header says. Zero regions cost nothing on a load, guest memory being
+// cleared already, and a compare on a reload.
+
+static void load_sections(Machine *arm, const uint8_t *image, bool reload) {
+	armemu_image_header header;
+	memcpy(&header, image, sizeof(header));
+	const uint8_t *data = &image[sizeof(header) + header.segment_count * sizeof(armemu_image_segment)];
+	uint32_t end = 0;
+	for (uint32_t i = 0; i < header.segment_count; i++) {
+		armemu_image_segment segment = image_segment(image, i);
+		if (reload) {
+			reload_range(arm, end, NULL, segment.address - end);
+			reload_range(arm, segment.address, data, segment.size);
+		} else {
+			memcpy(&arm->memory[segment.address], data, segment.size);
+		}
+		data += segment.size;
+		end = segment.address + segment.size;
+	}
+	if (reload) {
+		reload_range(arm, end, NULL, MEMORY_SIZE - end);
+	}
+
+	arm->pc_reg = header.entry + PIPELINE_OFFSET;
+	arm->general_reg[SP_REG] = header.stack_top ? header.stack_top : MEMORY_SIZE;
+	arm->stack_limit = header.stack_limit;
+}
+
+bool armemu_load(armemu_machine *arm, const uint8_t *image, size_t length) {
+	armemu_reset(arm);
+	enum armemu_fault fault = check_image(image, length);
+	if (fault != ARMEMU_OK) {
+		arm->fault = fault;
+		arm->end = true;
+		return false;
+	}
+	if (is_sectioned(image, length)) {
+		load_sections(arm, image, false);
+		return true;
+	}
+	memcpy(arm->memory, image, length);
+
+	// the stack may grow down to just past the loaded instructions
+	arm->stack_limit = (length + 1) / 4 * 4 + 1;
+	return true;
+}
+
+bool armemu_reload(armemu_machine *arm, const uint8_t *image, size_t length) {
+	if (check_image(image, length) != ARMEMU_OK) {
+		return armemu_load(arm, image, length);
+	}
+	reset_registers(arm);
+	if (is_sectioned(image, length)) {
+		load_sections(arm, image, true);
+		return true;
+	}
+
+	// a last partial word is padded with zeros
+	uint32_t words = length / 4 * 4;
+	reload_range(arm, 0, image, words);
+	if (words < length) {
+		uint8_t last[4] = {0};
+		memcpy(last, &image[words], length - words);
+		reload_range(arm, words, last, sizeof(last));
+		words += sizeof(last);
+	}
+	reload_range(arm, words, NULL, MEMORY_SIZE - words);
+	arm->stack_limit = (length + 1) / 4 * 4 + 1;
+	return true;
+}
+
+bool armemu_map_device(armemu_machine *arm, uint32_t start, uint32_t size,
+                       armemu_mmio_read read, armemu_mmio_write write, void *device) {
+	if (arm->mmio_count == ARMEMU_MAX_DEVICES || start < MEMORY_SIZE || start + size < start) {
+		return false;
+	}
+	Mmio_Region *region = &arm->mmio[arm->mmio_count++];
+	region->start = start;
+	region->size = size;
+	region->read = read;
+	region->write = write;
+	region->device = device;
+	return true;
+}
+
+void armemu_invalidate(armemu_machine *arm, uint32_t address, size_t length) {
+	for (size_t i = 0; i < length; i += sizeof(uint32_t)) {
+		host_write(arm, address + i);
+	}
+	if (length) {
+		host_write(arm, address + length - 1);
+	}
+}
+
+// --
+// -- Pipeline
+// --
+
+// Instructions are decoded once into 'predecoded' and executed from there.
+// The PC is kept 8 bytes ahead of the executing instruction, as if the
+// fetch and decode stages were full; a taken branch skips the refill.
+// Returns the instructions executed, more than one for a fused group.
+// Groups are only fused while 'budget' can hold the longest one.
+
+static uint64_t step(Machine *arm, uint64_t budget) {
+	HOST_STAGE(arm, STAGE_FETCH);
+	uint32_t address = arm->pc_reg - PIPELINE_OFFSET;
+	if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+		arm->fault = ARMEMU_PC_OUT_OF_RANGE;
+		arm->fault_addr = address;
+		arm->end = true;
+		return 0;
+	}
+	Decoded_Instr *instr = predecode(arm, address);
+	TIMING_ISSUE(arm, address, instr);
+	HOST_STAGE(arm, STAGE_EXECUTE);
+	if (arm->fusion && !TIMING_ATTACHED(arm) && !FUZZ_ATTACHED(arm) && budget >= FUSION_MAX_LENGTH) {
+		if (!instr->fusion_checked) {
+			fuse(arm, address);
+		}
+		if (instr->fusion != NO_FUSION) {
+			uint64_t done = run_fused(arm, instr, budget);
+			arm->steps += done;
+			return done;
+		}
+	}
+
+	execute(instr, arm, arm->data_proc_func);
+	arm->steps++;
+	if (arm->end) {
+		return 1;      // <- halt, the PC stays on the instruction after next
+	}
+	if (arm->branch_executed) {
+		arm->pc_reg += PIPELINE_OFFSET;
+		arm->branch_executed = false;
+	} else {
+		arm->pc_reg += sizeof(uint32_t);
+	}
+	return 1;
+}
+
+// Breakpoints and watchpoints stop a run as halts do, which is set right
+// once the run is over rather than in step(): a breakpoint's instruction
+// is not executed, and a watchpoint's store is. Returns the instructions
+// counted for the breakpoint.
+
+static uint64_t stopped(Machine *arm) {
+	switch (arm->fault) {
+	case ARMEMU_BREAKPOINT:
+		arm->steps--;
+		return 1;
+	case ARMEMU_WATCHPOINT:
+		arm->pc_reg += sizeof(uint32_t);
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+// A machine stopped at a breakpoint or watchpoint carries on. The
+// instruction under a breakpoint is decoded in its place for one step,
+// then the breakpoint put back. Returns the instructions executed.
+
+static uint64_t resume(Machine *arm) {
+	if (!arm->end || (arm->fault != ARMEMU_BREAKPOINT && arm->fault != ARMEMU_WATCHPOINT)) {
+		return 0;
+	}
+	bool breakpoint = arm->fault == ARMEMU_BREAKPOINT;
+	arm->end = false;
+	arm->fault = ARMEMU_OK;
+	if (!breakpoint) {
+		return 0;
+	}
+	uint32_t address = arm->pc_reg - PIPELINE_OFFSET;
+	Decoded_Instr *decoded = &arm->predecoded[address / 4];
+	Instr instr = {true, 0};
+	memcpy(&instr.bits, &arm->memory[address], sizeof(uint32_t));
+	decode(decoded, &instr, arm);
+	decoded->fusion = NO_FUSION;
+	decoded->fusion_checked = true;
+	uint64_t done = step(arm, 1);
+	drop_decoded(arm, address);
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		if (arm->breakpoints[i] == address) {
+			tag_breakpoint(arm, address);
+		}
+	}
+	if (arm->end) {
+		done -= stopped(arm);
+	}
+	return done;
+}
+
+uint64_t armemu_step(armemu_machine *arm, uint64_t count) {
+	uint64_t done = count ? resume(arm) : 0;
+	if (arm->end) {
+		return done;
+	}
+	while (done < count && !arm->end) {
+		done += step(arm, count - done);
+	}
+	if (arm->end) {
+		done -= stopped(arm);
+	}
+	return done;
+}
+
+uint64_t armemu_run(armemu_machine *arm) {
+	uint64_t start = arm->steps;
+	resume(arm);
+	if (arm->end) {
+		return arm->steps - start;
+	}
+	while (!arm->end) {
+		step(arm, UINT64_MAX);
+	}
+	stopped(arm);
+	return arm->steps - start;
+}
+
+static uint64_t now_ms(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+// The budget is handed to armemu_step() in chunks no longer than the clock
+// interval, so the per-instruction cost is the one step counter compare.
+
+uint64_t armemu_run_limited(armemu_machine *arm, uint64_t max_steps, uint64_t max_wall_ms) {
+	uint64_t start = arm->steps;
+	uint64_t deadline = max_wall_ms ? now_ms() + max_wall_ms : 0;
+	uint64_t budget = max_steps ? max_steps : UINT64_MAX;
+	resume(arm);
+
+	while (!arm->end) {
+		uint64_t chunk = budget - (arm->steps - start);
+		if (chunk == 0) {
+			arm->fault = ARMEMU_STEP_LIMIT;
+			break;
+		}
+		if (deadline && chunk > ARMEMU_CLOCK_INTERVAL) {
+			chunk = ARMEMU_CLOCK_INTERVAL;
+		}
+		armemu_step(arm, chunk);
+		if (arm->fault == ARMEMU_SPIN && !max_steps) {
+			arm->end = true;        // <- only the clock would stop it
+			break;
+		}
+		if (deadline && !arm->end && now_ms() >= deadline) {
+			arm->fault = ARMEMU_TIME_LIMIT;
+			break;
+		}
+	}
+	return arm->steps - start;
+}
+
+// --
+// -- Breakpoints and watchpoints
+// --
+
+static void flag_trapped_pages(Machine *arm) {
+	arm->trapped_pages = 0;
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		arm->trapped_pages |= 1ull << (arm->breakpoints[i] >> TRAP_PAGE_SHIFT);
+	}
+	for (int i = 0; i < arm->watchpoint_count; i++) {
+		Watchpoint *watch = &arm->watchpoints[i];
+		uint32_t last = (watch->address + watch->length - 1) >> TRAP_PAGE_SHIFT;
+		for (uint32_t page = watch->address >> TRAP_PAGE_SHIFT; page <= last; page++) {
+			arm->trapped_pages |= 1ull << page;
+		}
+	}
+}
+
+// A breakpoint on a word holding any of the 'length' bytes at 'address',
+// dropped by a write, is tagged again
+
+static void retag_breakpoints(Machine *arm, uint32_t address, uint32_t length) {
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		if (arm->breakpoints[i] / 4 - address / 4 <= (address + length - 1) / 4 - address / 4) {
+			tag_breakpoint(arm, arm->breakpoints[i]);
+		}
+	}
+}
+
+// The first store overlapping a watched range stops the run, at the
+// first watched byte written, and a breakpoint stored over is tagged
+// again
+
+void trapped_store(Machine *arm, uint32_t address, uint32_t length) {
+	for (int i = 0; i < arm->watchpoint_count; i++) {
+		Watchpoint *watch = &arm->watchpoints[i];
+		if (watch->address < address + length && address < watch->address + watch->length) {
+			if (arm->fault != ARMEMU_WATCHPOINT) {
+				arm->fault = ARMEMU_WATCHPOINT;
+				arm->fault_addr = address > watch->address ? address : watch->address;
+			}
+			arm->end = true;
+			break;
+		}
+	}
+	retag_breakpoints(arm, address, length);
+}
+
+static void host_write(Machine *arm, uint32_t address) {
+	if (address >= MEMORY_SIZE) {
+		return;
+	}
+	drop_decoded(arm, address);
+	if (arm->trapped_pages & (1ull << (address >> TRAP_PAGE_SHIFT))) {
+		retag_breakpoints(arm, address, 1);
+	}
+}
+
+bool armemu_set_breakpoint(armemu_machine *arm, uint32_t address) {
+	if (address % 4 || address > MEMORY_SIZE - sizeof(uint32_t)) {
+		return false;
+	}
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		if (arm->breakpoints[i] == address) {
+			return true;
+		}
+	}
+	if (arm->breakpoint_count == ARMEMU_MAX_BREAKPOINTS) {
+		return false;
+	}
+	arm->breakpoints[arm->breakpoint_count++] = address;
+	flag_trapped_pages(arm);
+	tag_breakpoint(arm, address);
+	return true;
+}
+
+bool armemu_clear_breakpoint(armemu_machine *arm, uint32_t address) {
+	for (int i = 0; i < arm->breakpoint_count; i++) {
+		if (arm->breakpoints[i] == address) {
+			arm->breakpoints[i] = arm->breakpoints[--arm->breakpoint_count];
+			flag_trapped_pages(arm);
+			drop_decoded(arm, address);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool armemu_set_watchpoint(armemu_machine *arm, uint32_t address, uint32_t length) {
+	if (length == 0 || address >= MEMORY_SIZE || length > MEMORY_SIZE - address
+	    || arm->watchpoint_count == ARMEMU_MAX_WATCHPOINTS) {
+		return false;
+	}
+	arm->watchpoints[arm->watchpoint_count++] = (Watchpoint) {address, length};
+	flag_trapped_pages(arm);
+	return true;
+}
+
+bool armemu_clear_watchpoint(armemu_machine *arm, uint32_t address, uint32_t length) {
+	for (int i = 0; i < arm->watchpoint_count; i++) {
+		Watchpoint *watch = &arm->watchpoints[i];
+		if (watch->address == address && watch->length == length) {
+			*watch = arm->watchpoints[--arm->watchpoint_count];
+			flag_trapped_pages(arm);
+			return true;
+		}
+	}
+	return false;
+}
+
+// --
+// -- State accessors
+// --
+
+bool armemu_halted(const armemu_machine *arm) {
+	return arm->end;
+}
+
+enum armemu_fault armemu_fault(const armemu_machine *arm) {
+	return arm->fault;
+}
+
+uint32_t armemu_fault_address(const armemu_machine *arm) {
+	return arm->fault_addr;
+}
+
+uint64_t armemu_steps(const armemu_machine *arm) {
+	return arm->steps;
+}
+
+void armemu_set_fusion(armemu_machine *arm, bool enabled) {
+	arm->fusion = enabled;
+}
+
+uint32_t *armemu_registers(armemu_machine *arm) {
+	return arm->general_reg;
+}
+
+uint32_t armemu_pc(const armemu_machine *arm) {
+	return arm->pc_reg;
+}
+
+uint32_t armemu_cpsr(const armemu_machine *arm) {
+	return arm->cpsr_reg;
+}
+
+uint8_t *armemu_memory(armemu_machine *arm, size_t *size) {
+	if (size != NULL) {
+		*size = MEMORY_SIZE;
+	}
+	return arm->memory;
+}
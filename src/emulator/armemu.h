@@ -0,0 +1,215 @@
+#ifndef ARMEMU_H
+#define ARMEMU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// --
+// -- libarmemu: the emulator core as a library
+// --
+// Build with 'make libarmemu.a' or 'make libarmemu.so'.
+//
+// A machine is created once and can be loaded and run any number of times.
+// Machines share no state, so different machines may run on different
+// threads. Nothing is printed: the run outcome is read back through
+// armemu_fault() and the register/memory accessors.
+
+typedef struct Machine armemu_machine;
+
+enum armemu_fault {
+	ARMEMU_OK,
+	ARMEMU_IMAGE_TOO_LARGE,    // image does not fit in guest memory
+	ARMEMU_PC_OUT_OF_RANGE,    // fetch outside guest memory (fatal)
+	ARMEMU_STACK_LIMIT,        // block transfer crossed the stack limit (fatal)
+	ARMEMU_OUT_OF_BOUNDS,      // single transfer outside guest memory, skipped
+	ARMEMU_STEP_LIMIT,         // armemu_run_limited() ran out of instructions
+	ARMEMU_TIME_LIMIT,         // armemu_run_limited() ran out of time
+	ARMEMU_SPIN,               // branch to itself, stopped when no step limit would end it
+	ARMEMU_BREAKPOINT,         // stopped before the instruction at a breakpoint
+	ARMEMU_WATCHPOINT,         // stopped after a store into a watched range
+	ARMEMU_BAD_IMAGE           // sectioned image with a malformed header or segment table
+};
+
+// How many instructions armemu_run_limited() executes between clock reads.
+#define ARMEMU_CLOCK_INTERVAL (1 << 16)
+
+// Allocate a zeroed, halted machine. Returns NULL if out of memory.
+armemu_machine *armemu_create(void);
+
+void armemu_destroy(armemu_machine *arm);
+
+// Machines start on a cache line, their registers and run state on the
+// first two, apart from guest memory.
+#define ARMEMU_MACHINE_ALIGN 64
+
+// Bytes a machine takes, a multiple of ARMEMU_MACHINE_ALIGN.
+size_t armemu_machine_size(void);
+
+// Storage for 'count' machines in one block, for pools: machine i starts
+// i * armemu_machine_size() bytes in. Blocks of 2 MiB or more are backed
+// by transparent huge pages where the system has them. Returns NULL if
+// out of memory; free with free().
+void *armemu_alloc_machines(size_t count);
+
+// Make a zeroed, halted machine in 'storage', ARMEMU_MACHINE_ALIGN
+// aligned and armemu_machine_size() bytes long. The machine is not passed
+// to armemu_destroy(): it goes with its storage.
+armemu_machine *armemu_init(void *storage);
+
+// Clear memory, registers and pipeline.
+void armemu_reset(armemu_machine *arm);
+
+// Reset the machine and copy a flat binary image to address 0, or the
+// segments of a sectioned image (see below) to theirs. Returns false (and
+// sets ARMEMU_IMAGE_TOO_LARGE or ARMEMU_BAD_IMAGE) if it does not fit or
+// is malformed.
+bool armemu_load(armemu_machine *arm, const uint8_t *image, size_t length);
+
+// Like armemu_load(), but keeps the decoded instructions of the words the
+// image leaves unchanged, so a machine running the same image again does
+// not decode it again. Costs a compare of guest memory with the image.
+bool armemu_reload(armemu_machine *arm, const uint8_t *image, size_t length);
+
+// Execute up to 'count' instructions. Returns how many were executed,
+// fewer than 'count' only if the machine halted or faulted. A machine
+// stopped at a breakpoint or watchpoint carries on, here and below.
+uint64_t armemu_step(armemu_machine *arm, uint64_t count);
+
+// Execute until halt or a fatal fault. Returns the instructions executed.
+uint64_t armemu_run(armemu_machine *arm);
+
+// Like armemu_run(), but also stops after 'max_steps' instructions or
+// 'max_wall_ms' milliseconds of wall time, 0 meaning no limit. The clock is
+// read once every ARMEMU_CLOCK_INTERVAL instructions, so the time limit
+// may overshoot by that much. Stopping on a limit records
+// ARMEMU_STEP_LIMIT or ARMEMU_TIME_LIMIT and leaves the machine resumable.
+uint64_t armemu_run_limited(armemu_machine *arm, uint64_t max_steps, uint64_t max_wall_ms);
+
+// Instructions are decoded once and kept until a guest store overwrites
+// them. Memory written through armemu_memory() between runs must be
+// invalidated here before it is executed. Breakpoints there are kept; as
+// the write is not a guest store, no watchpoint sees it.
+void armemu_invalidate(armemu_machine *arm, uint32_t address, size_t length);
+
+// Run common instruction sequences (sub/cmp/branch loops, ldr+add) as one
+// superinstruction, and skip ahead through delay loops counting a
+// register down. On by default; the final state does not depend on it,
+// except that a branch to itself stops armemu_run() and a time limited
+// run with ARMEMU_SPIN rather than looping forever. The setting is kept
+// across armemu_reset() and loads.
+void armemu_set_fusion(armemu_machine *arm, bool enabled);
+
+bool armemu_halted(const armemu_machine *arm);
+
+// Last fault recorded since the image was loaded, and the address it hit.
+enum armemu_fault armemu_fault(const armemu_machine *arm);
+
+uint32_t armemu_fault_address(const armemu_machine *arm);
+
+// Instructions executed since the image was loaded.
+uint64_t armemu_steps(const armemu_machine *arm);
+
+// --
+// -- Sectioned images
+// --
+// An image starting with ARMEMU_IMAGE_MAGIC, as 'assemble -s' writes it,
+// stores only the non-zero parts of guest memory. It is laid out as
+//
+//   armemu_image_header
+//   armemu_image_segment   segment_count of them, by increasing address
+//   segment bytes          of each segment in turn
+//
+// all little-endian. Memory no segment covers is zero: the 'bss_size'
+// bytes after the last segment, and any zeroed table between two. The
+// image itself must still be smaller than guest memory.
+//
+// The machine starts at 'entry' with sp at 'stack_top', 0 meaning the top
+// of guest memory. As for a flat image, whose limit is just past its end,
+// block transfers reaching down to 'stack_limit' fault.
+
+#define ARMEMU_IMAGE_MAGIC 0x494d5241 // "ARMI"
+
+typedef struct {
+	uint32_t magic;
+	uint32_t entry;
+	uint32_t stack_top;
+	uint32_t stack_limit;
+	uint32_t bss_size;
+	uint32_t segment_count;
+} armemu_image_header;
+
+typedef struct {
+	uint32_t address;       // word aligned
+	uint32_t size;          // bytes, a multiple of 4
+} armemu_image_segment;
+
+// --
+// -- Memory-mapped devices
+// --
+// Loads and stores outside guest memory are offered to the mapped devices
+// before being reported out of bounds; 'offset' is relative to 'start'.
+// Accesses are whole words. Mappings survive armemu_reset()/armemu_load().
+
+#define ARMEMU_MAX_DEVICES 8
+
+typedef uint32_t (*armemu_mmio_read)(void *device, uint32_t offset);
+typedef void (*armemu_mmio_write)(void *device, uint32_t offset, uint32_t value);
+
+// Returns false if the range overlaps guest memory or the table is full.
+bool armemu_map_device(armemu_machine *arm, uint32_t start, uint32_t size,
+                       armemu_mmio_read read, armemu_mmio_write write, void *device);
+
+// --
+// -- Breakpoints and watchpoints
+// --
+// A breakpoint replaces the decoded instruction at its address, so that
+// running into it stops the run like a halt would, recording
+// ARMEMU_BREAKPOINT with the PC on the instruction, not yet executed.
+// Resuming runs the instruction under the breakpoint, decoded afresh,
+// once.
+//
+// A watchpoint stops the run at the first store into its range, which
+// completes its instruction, recording ARMEMU_WATCHPOINT with the store
+// address as the fault address and the PC on the next instruction.
+//
+// Both flag the 1KB pages they are in, and only the stores to flagged
+// pages look them up; runs without either pay nothing for them.
+//
+// Both survive armemu_reset()/armemu_load().
+
+#define ARMEMU_MAX_BREAKPOINTS 64
+#define ARMEMU_MAX_WATCHPOINTS 16
+
+// Returns false if 'address' is not a word in guest memory or the table
+// is full. Setting one twice is allowed.
+bool armemu_set_breakpoint(armemu_machine *arm, uint32_t address);
+
+// Returns false if there is no breakpoint at 'address'.
+bool armemu_clear_breakpoint(armemu_machine *arm, uint32_t address);
+
+// Returns false if the range is empty, outside guest memory, or the table
+// is full.
+bool armemu_set_watchpoint(armemu_machine *arm, uint32_t address, uint32_t length);
+
+// Returns false if no watchpoint has this range.
+bool armemu_clear_watchpoint(armemu_machine *arm, uint32_t address, uint32_t length);
+
+// --
+// -- Zero-copy state accessors
+// --
+// The returned pointers stay valid until armemu_destroy() and may be
+// written to between runs.
+
+// r0 - r14, indexed by register number.
+uint32_t *armemu_registers(armemu_machine *arm);
+
+// PC as the guest sees it: 8 bytes ahead of the executing instruction.
+uint32_t armemu_pc(const armemu_machine *arm);
+
+uint32_t armemu_cpsr(const armemu_machine *arm);
+
+// Guest memory, little-endian; its size is stored in 'size' if not NULL.
+uint8_t *armemu_memory(armemu_machine *arm, size_t *size);
+
+#endif
@@ -0,0 +1,528 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "batch_io.h"
+#include "define_structures.h"
+
+// More than the reads and the write in flight at once
+#define URING_ENTRIES 32
+
+// Completions of reads carry their slot, of writes this
+#define WRITE_DATA BATCH_IO_DEPTH
+
+enum slot_state {
+	SLOT_FREE,
+	SLOT_OPENING,
+	SLOT_READING,
+	SLOT_READY,
+	SLOT_TAKEN              // handed out by batch_io_next()
+};
+
+struct Slot {
+	Batch_Image image;
+	enum slot_state state;
+	int fd;
+};
+typedef struct Slot Slot;
+
+// Rings shared with the kernel, as io_uring_setup(2) maps them
+struct Uring {
+	int fd;
+	unsigned *sq_head;
+	unsigned *sq_tail;
+	unsigned *sq_mask;
+	unsigned *sq_array;
+	unsigned sq_entries;
+	struct io_uring_sqe *sqes;
+	unsigned *cq_head;
+	unsigned *cq_tail;
+	unsigned *cq_mask;
+	struct io_uring_cqe *cqes;
+	void *sq_ring;
+	size_t sq_ring_size;
+	void *cq_ring;
+	size_t cq_ring_size;
+	size_t sqes_size;
+	unsigned queued;        // entries not submitted yet
+};
+typedef struct Uring Uring;
+
+struct Batch_Io {
+	char **paths;
+	uint32_t count;
+	int out_fd;
+	size_t output_size;
+
+	Slot slots[BATCH_IO_DEPTH];     // image i in slot i % BATCH_IO_DEPTH
+	uint32_t opened;                // images whose read has started
+	uint32_t taken;                 // images handed out
+
+	// results queued, the oldest being written
+	uint8_t *outputs[BATCH_IO_DEPTH];
+	size_t lengths[BATCH_IO_DEPTH];
+	uint32_t out_head;
+	uint32_t out_count;
+	size_t written;                 // bytes of the oldest written so far
+	bool writing;                   // io_uring write in flight
+	bool write_failed;
+
+	bool uring;
+	Uring ring;
+
+	// without io_uring
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	pthread_t reader;
+	pthread_t writer;
+	bool done;
+};
+
+// --
+// -- io_uring
+// --
+// Used through the raw system calls. Images are opened, then read until
+// full or at end of file, then closed; results are written at the file
+// position, one at a time to keep them in order.
+
+static bool uring_setup(Uring *ring) {
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	ring->fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &params);
+	if (ring->fd < 0) {
+		return false;
+	}
+	if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+		close(ring->fd);
+		return false;
+	}
+
+	ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+	if (single && ring->cq_ring_size > ring->sq_ring_size) {
+		ring->sq_ring_size = ring->cq_ring_size;
+	}
+	ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+	                     MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+	ring->cq_ring = single ? ring->sq_ring
+	                : mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+	                       MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+	ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+	                  MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+	if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+		close(ring->fd);
+		return false;
+	}
+	if (single) {
+		ring->cq_ring_size = 0;
+	}
+
+	uint8_t *sq = ring->sq_ring;
+	ring->sq_head = (unsigned *) (sq + params.sq_off.head);
+	ring->sq_tail = (unsigned *) (sq + params.sq_off.tail);
+	ring->sq_mask = (unsigned *) (sq + params.sq_off.ring_mask);
+	ring->sq_array = (unsigned *) (sq + params.sq_off.array);
+	ring->sq_entries = params.sq_entries;
+	uint8_t *cq = ring->cq_ring;
+	ring->cq_head = (unsigned *) (cq + params.cq_off.head);
+	ring->cq_tail = (unsigned *) (cq + params.cq_off.tail);
+	ring->cq_mask = (unsigned *) (cq + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+	ring->queued = 0;
+	return true;
+}
+
+static void uring_close(Uring *ring) {
+	munmap(ring->sqes, ring->sqes_size);
+	if (ring->cq_ring_size) {
+		munmap(ring->cq_ring, ring->cq_ring_size);
+	}
+	munmap(ring->sq_ring, ring->sq_ring_size);
+	close(ring->fd);
+}
+
+// Submit the entries queued, and wait for 'wait' completions
+
+static void uring_enter(Uring *ring, unsigned wait) {
+	for (;;) {
+		long submitted = syscall(__NR_io_uring_enter, ring->fd, ring->queued, wait,
+		                         wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+		if (submitted >= 0) {
+			ring->queued -= submitted;
+			return;
+		}
+		if (errno != EINTR) {
+			return;
+		}
+	}
+}
+
+static void uring_queue(Uring *ring, uint8_t opcode, int fd, const void *addr, uint32_t length,
+                        uint64_t offset, uint32_t flags, uint64_t data) {
+	unsigned tail = *ring->sq_tail;
+	if (tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) == ring->sq_entries) {
+		uring_enter(ring, 0);
+	}
+	unsigned i = tail & *ring->sq_mask;
+	struct io_uring_sqe *sqe = &ring->sqes[i];
+	memset(sqe, 0, sizeof(struct io_uring_sqe));
+	sqe->opcode = opcode;
+	sqe->fd = fd;
+	sqe->addr = (uintptr_t) addr;
+	sqe->len = length;
+	sqe->off = offset;
+	sqe->open_flags = flags;
+	sqe->user_data = data;
+	ring->sq_array[i] = i;
+	__atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	ring->queued++;
+}
+
+static void uring_read(Batch_Io *io, Slot *slot) {
+	uring_queue(&io->ring, IORING_OP_READ, slot->fd, slot->image.data + slot->image.size,
+	            MEMORY_SIZE - slot->image.size, slot->image.size, 0, slot - io->slots);
+}
+
+static void uring_write(Batch_Io *io) {
+	uint8_t *buffer = io->outputs[io->out_head];
+	uring_queue(&io->ring, IORING_OP_WRITE, io->out_fd, buffer + io->written,
+	            io->lengths[io->out_head] - io->written, (uint64_t) -1, 0, WRITE_DATA);
+	io->writing = true;
+}
+
+static void uring_written(Batch_Io *io, int res) {
+	io->writing = false;
+	if (res == -EINTR || res == -EAGAIN) {
+		uring_write(io);
+		return;
+	}
+	if (res < 0) {
+		io->write_failed = true;
+		io->written = io->lengths[io->out_head];
+	} else {
+		io->written += res;
+	}
+	if (io->written < io->lengths[io->out_head]) {
+		uring_write(io);
+		return;
+	}
+	io->out_head = (io->out_head + 1) % BATCH_IO_DEPTH;
+	io->out_count--;
+	io->written = 0;
+	if (io->out_count) {
+		uring_write(io);
+	}
+}
+
+static void uring_complete(Batch_Io *io, uint64_t data, int res) {
+	if (data == WRITE_DATA) {
+		uring_written(io, res);
+		return;
+	}
+	Slot *slot = &io->slots[data];
+	if (slot->state == SLOT_OPENING) {
+		if (res < 0) {
+			slot->image.error = -res;
+			slot->state = SLOT_READY;
+		} else {
+			slot->fd = res;
+			slot->state = SLOT_READING;
+			uring_read(io, slot);
+		}
+		return;
+	}
+	if (res < 0) {
+		slot->image.error = -res;
+	} else if (res > 0 && (slot->image.size += res) < MEMORY_SIZE) {
+		uring_read(io, slot);      // <- short read, not at the end yet
+		return;
+	}
+	close(slot->fd);
+	slot->state = SLOT_READY;
+}
+
+// Submit what is queued and handle the completions, waiting for one if
+// 'wait'. The kernel posts completions when the task enters it, so it is
+// entered even with nothing to submit.
+
+static void uring_poll(Batch_Io *io, bool wait) {
+	Uring *ring = &io->ring;
+	uring_enter(ring, wait);
+	unsigned head = *ring->cq_head;
+	while (head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+		struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+		uint64_t data = cqe->user_data;
+		int res = cqe->res;
+		head++;
+		__atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+		uring_complete(io, data, res);
+	}
+	if (ring->queued) {
+		uring_enter(ring, 0);
+	}
+}
+
+// Start reading images into the free slots
+static void uring_fill(Batch_Io *io) {
+	while (io->opened < io->count) {
+		Slot *slot = &io->slots[io->opened % BATCH_IO_DEPTH];
+		if (slot->state != SLOT_FREE) {
+			break;
+		}
+		slot->image.index = io->opened;
+		slot->image.error = 0;
+		slot->image.size = 0;
+		slot->state = SLOT_OPENING;
+		uring_queue(&io->ring, IORING_OP_OPENAT, AT_FDCWD, io->paths[io->opened],
+		            0, 0, O_RDONLY, slot - io->slots);
+		io->opened++;
+	}
+}
+
+// --
+// -- Threads
+// --
+// Without io_uring a thread reads the images ahead with ordinary system
+// calls, and another writes the results.
+
+static void read_image(const char *path, Batch_Image *image) {
+	image->error = 0;
+	image->size = 0;
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		image->error = errno;
+		return;
+	}
+	while (image->size < MEMORY_SIZE) {
+		ssize_t n = read(fd, image->data + image->size, MEMORY_SIZE - image->size);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n < 0) {
+			image->error = errno;
+		}
+		if (n <= 0) {
+			break;
+		}
+		image->size += n;
+	}
+	close(fd);
+}
+
+static void *read_images(void *arg) {
+	Batch_Io *io = arg;
+	for (uint32_t i = 0; i < io->count; i++) {
+		Slot *slot = &io->slots[i % BATCH_IO_DEPTH];
+		pthread_mutex_lock(&io->lock);
+		while (slot->state != SLOT_FREE && !io->done) {
+			pthread_cond_wait(&io->changed, &io->lock);
+		}
+		bool done = io->done;
+		pthread_mutex_unlock(&io->lock);
+		if (done) {
+			break;
+		}
+
+		slot->image.index = i;
+		read_image(io->paths[i], &slot->image);
+		pthread_mutex_lock(&io->lock);
+		slot->state = SLOT_READY;
+		pthread_cond_broadcast(&io->changed);
+		pthread_mutex_unlock(&io->lock);
+	}
+	return NULL;
+}
+
+static bool write_all(int fd, const uint8_t *buffer, size_t length) {
+	while (length) {
+		ssize_t n = write(fd, buffer, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		buffer += n;
+		length -= n;
+	}
+	return true;
+}
+
+static void *write_results(void *arg) {
+	Batch_Io *io = arg;
+	pthread_mutex_lock(&io->lock);
+	for (;;) {
+		while (io->out_count == 0 && !io->done) {
+			pthread_cond_wait(&io->changed, &io->lock);
+		}
+		if (io->out_count == 0) {
+			break;
+		}
+		uint8_t *buffer = io->outputs[io->out_head];
+		size_t length = io->lengths[io->out_head];
+		pthread_mutex_unlock(&io->lock);
+		bool ok = write_all(io->out_fd, buffer, length);
+		pthread_mutex_lock(&io->lock);
+		if (!ok) {
+			io->write_failed = true;
+		}
+		io->out_head = (io->out_head + 1) % BATCH_IO_DEPTH;
+		io->out_count--;
+		pthread_cond_broadcast(&io->changed);
+	}
+	pthread_mutex_unlock(&io->lock);
+	return NULL;
+}
+
+// --
+// -- Batches
+// --
+
+static void free_buffers(Batch_Io *io) {
+	for (int i = 0; i < BATCH_IO_DEPTH; i++) {
+		free(io->slots[i].image.data);
+		free(io->outputs[i]);
+	}
+	free(io);
+}
+
+Batch_Io *batch_io_create(char **paths, uint32_t count, int out_fd, size_t output_size, bool threads) {
+	Batch_Io *io = calloc(1, sizeof(Batch_Io));
+	if (io == NULL) {
+		return NULL;
+	}
+	io->paths = paths;
+	io->count = count;
+	io->out_fd = out_fd;
+	io->output_size = output_size;
+	for (int i = 0; i < BATCH_IO_DEPTH; i++) {
+		io->slots[i].state = SLOT_FREE;
+		io->slots[i].image.data = malloc(MEMORY_SIZE);
+		io->outputs[i] = malloc(output_size);
+		if (io->slots[i].image.data == NULL || io->outputs[i] == NULL) {
+			free_buffers(io);
+			return NULL;
+		}
+	}
+
+	io->uring = !threads && uring_setup(&io->ring);
+	if (io->uring) {
+		uring_fill(io);
+		uring_enter(&io->ring, 0);
+		return io;
+	}
+	pthread_mutex_init(&io->lock, NULL);
+	pthread_cond_init(&io->changed, NULL);
+	pthread_create(&io->reader, NULL, read_images, io);
+	pthread_create(&io->writer, NULL, write_results, io);
+	return io;
+}
+
+bool batch_io_uring(const Batch_Io *io) {
+	return io->uring;
+}
+
+Batch_Image *batch_io_next(Batch_Io *io) {
+	if (io->taken == io->count) {
+		return NULL;
+	}
+	Slot *slot = &io->slots[io->taken % BATCH_IO_DEPTH];
+	if (io->uring) {
+		while (slot->state != SLOT_READY) {
+			uring_poll(io, true);
+		}
+	} else {
+		pthread_mutex_lock(&io->lock);
+		while (slot->state != SLOT_READY) {
+			pthread_cond_wait(&io->changed, &io->lock);
+		}
+		pthread_mutex_unlock(&io->lock);
+	}
+	slot->state = SLOT_TAKEN;
+	io->taken++;
+	return &slot->image;
+}
+
+void batch_io_release(Batch_Io *io, Batch_Image *image) {
+	Slot *slot = &io->slots[image->index % BATCH_IO_DEPTH];
+	if (io->uring) {
+		slot->state = SLOT_FREE;
+		uring_fill(io);
+		uring_poll(io, false);
+		return;
+	}
+	pthread_mutex_lock(&io->lock);
+	slot->state = SLOT_FREE;
+	pthread_cond_broadcast(&io->changed);
+	pthread_mutex_unlock(&io->lock);
+}
+
+uint8_t *batch_io_output(Batch_Io *io) {
+	if (io->uring) {
+		while (io->out_count == BATCH_IO_DEPTH) {
+			uring_poll(io, true);
+		}
+		return io->outputs[(io->out_head + io->out_count) % BATCH_IO_DEPTH];
+	}
+	pthread_mutex_lock(&io->lock);
+	while (io->out_count == BATCH_IO_DEPTH) {
+		pthread_cond_wait(&io->changed, &io->lock);
+	}
+	uint8_t *buffer = io->outputs[(io->out_head + io->out_count) % BATCH_IO_DEPTH];
+	pthread_mutex_unlock(&io->lock);
+	return buffer;
+}
+
+void batch_io_write(Batch_Io *io, uint8_t *buffer, size_t length) {
+	if (io->uring) {
+		io->lengths[(io->out_head + io->out_count) % BATCH_IO_DEPTH] = length;
+		io->out_count++;
+		if (!io->writing) {
+			uring_write(io);
+		}
+		uring_poll(io, false);
+		return;
+	}
+	pthread_mutex_lock(&io->lock);
+	io->lengths[(io->out_head + io->out_count) % BATCH_IO_DEPTH] = length;
+	io->out_count++;
+	pthread_cond_broadcast(&io->changed);
+	pthread_mutex_unlock(&io->lock);
+}
+
+bool batch_io_destroy(Batch_Io *io) {
+	if (io->uring) {
+		bool reading = true;
+		while (io->out_count || reading) {
+			reading = false;
+			for (int i = 0; i < BATCH_IO_DEPTH; i++) {
+				enum slot_state state = io->slots[i].state;
+				reading |= state == SLOT_OPENING || state == SLOT_READING;
+			}
+			if (io->out_count || reading) {
+				uring_poll(io, true);
+			}
+		}
+		uring_close(&io->ring);
+	} else {
+		pthread_mutex_lock(&io->lock);
+		io->done = true;
+		pthread_cond_broadcast(&io->changed);
+		pthread_mutex_unlock(&io->lock);
+		pthread_join(io->reader, NULL);
+		pthread_join(io->writer, NULL);
+		pthread_mutex_destroy(&io->lock);
+		pthread_cond_destroy(&io->changed);
+	}
+	bool ok = !io->write_failed;
+	free_buffers(io);
+	return ok;
+}
@@ -0,0 +1,57 @@
+#ifndef ARM11_18_BATCH_IO_H
+#define ARM11_18_BATCH_IO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// --
+// -- Asynchronous I/O for batch runs
+// --
+// Images are read ahead into a ring of BATCH_IO_DEPTH buffers and results
+// written from a ring of as many, in order, while the emulator runs, so
+// reading, running and writing overlap. I/O goes through io_uring where
+// the kernel has it, or else through a reading and a writing thread.
+//
+// The caller takes the images in order with batch_io_next() and gives each
+// buffer back with batch_io_release() once it is done with the image;
+// results are filled into the buffer batch_io_output() returns and queued
+// with batch_io_write().
+
+#define BATCH_IO_DEPTH 8
+
+struct Batch_Image {
+	uint32_t index;         // into the paths
+	int error;              // errno of the open or read failing, 0 if read
+	size_t size;            // bytes read, MEMORY_SIZE meaning at least that many
+	uint8_t *data;          // MEMORY_SIZE bytes
+};
+typedef struct Batch_Image Batch_Image;
+
+typedef struct Batch_Io Batch_Io;
+
+// Start reading the 'count' files in 'paths', which must outlive the
+// batch, and writing results to 'out_fd', with io_uring unless 'threads'.
+// 'output_size' is the largest result. Returns NULL if out of memory.
+Batch_Io *batch_io_create(char **paths, uint32_t count, int out_fd, size_t output_size, bool threads);
+
+// Whether io_uring is used
+bool batch_io_uring(const Batch_Io *io);
+
+// Next image in path order, waiting for it to be read; NULL after the last
+Batch_Image *batch_io_next(Batch_Io *io);
+
+// Give the buffer back to read another image into
+void batch_io_release(Batch_Io *io, Batch_Image *image);
+
+// Buffer of 'output_size' bytes to fill with the next result, waiting for
+// a write to finish if all are queued
+uint8_t *batch_io_output(Batch_Io *io);
+
+// Queue 'length' bytes of the buffer batch_io_output() last returned
+void batch_io_write(Batch_Io *io, uint8_t *buffer, size_t length);
+
+// Wait for the writes queued. Returns false if any failed.
+bool batch_io_destroy(Batch_Io *io);
+
+#endif //ARM11_18_BATCH_IO_H
@@ -0,0 +1,164 @@
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "console.h"
+#include "armemu.h"
+#include "decode_helpers.h"
+
+#define LINE_SIZE 256
+#define MAX_ARGS 3
+
+static Reverse *interrupted_reverse;
+
+static void interrupt(int signal) {
+	(void) signal;
+	reverse_interrupt(interrupted_reverse);
+}
+
+static const char *stop_names[] = {
+	[REVERSE_STEPPED] = "stepped",
+	[REVERSE_BREAKPOINT] = "breakpoint",
+	[REVERSE_WATCH] = "watched register changed",
+	[REVERSE_HALTED] = "halted",
+	[REVERSE_SPIN] = "branch to itself",
+	[REVERSE_START] = "first step",
+	[REVERSE_INTERRUPTED] = "interrupted"
+};
+
+static void print_stop(const Reverse *reverse, enum reverse_stop stop, FILE *out) {
+	Machine *arm = reverse->arm;
+	fprintf(out, "step %llu, pc 0x%08x: %s", (unsigned long long) arm->steps,
+	        arm->pc_reg - PIPELINE_OFFSET, stop_names[stop]);
+	if (stop == REVERSE_WATCH) {
+		fprintf(out, ", r%d = 0x%08x", reverse->watch, arm->general_reg[reverse->watch]);
+	}
+	if (stop == REVERSE_HALTED && arm->fault != ARMEMU_OK) {
+		fprintf(out, ", fault %u at 0x%08x", arm->fault, arm->fault_addr);
+	}
+	fprintf(out, "\n");
+}
+
+static void print_registers(const Machine *arm, FILE *out) {
+	for (int i = 0; i < GENERAL_REGISTERS_NUM; i++) {
+		fprintf(out, "$%-2d : %10d (0x%08x)\n", i, arm->general_reg[i], arm->general_reg[i]);
+	}
+	fprintf(out, "PC  : %10d (0x%08x)\n", arm->pc_reg, arm->pc_reg);
+	fprintf(out, "CPSR: %10d (0x%08x)\n", arm->cpsr_reg, arm->cpsr_reg);
+	fprintf(out, "Step: %llu\n", (unsigned long long) arm->steps);
+}
+
+static void print_memory(const Machine *arm, uint32_t address, uint32_t count, FILE *out) {
+	for (uint32_t i = 0; i < count; i++, address += 4) {
+		if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+			fprintf(out, "0x%08x: out of bounds\n", address);
+			return;
+		}
+		uint32_t word;
+		memcpy(&word, &arm->memory[address], sizeof(uint32_t));
+		fprintf(out, "0x%08x: 0x%08x\n", address, word);
+	}
+}
+
+static bool parse_number(const char *arg, uint64_t *value) {
+	char *end;
+	*value = strtoull(arg, &end, 0);
+	return *end == '\0' && end != arg;
+}
+
+static bool is_command(const char *command, const char *short_name, const char *name) {
+	return !strcmp(command, short_name) || !strcmp(command, name);
+}
+
+// Run one command line. Returns false on quit.
+static bool run_command(Reverse *reverse, char **args, int count, FILE *out) {
+	Machine *arm = reverse->arm;
+	const char *command = args[0];
+	uint64_t number = 1;
+	if (count > 1 && !parse_number(args[1], &number)) {
+		if (!is_command(command, "w", "watch") || args[1][0] != 'r'
+		    || !parse_number(args[1] + 1, &number) || number >= GENERAL_REGISTERS_NUM) {
+			fprintf(out, "Invalid argument %s\n", args[1]);
+			return true;
+		}
+	}
+	bool needs_number = is_command(command, "g", "goto") || is_command(command, "b", "break")
+	                    || is_command(command, "d", "delete") || !strcmp(command, "x");
+	if (needs_number && count < 2) {
+		fprintf(out, "%s needs an argument\n", command);
+		return true;
+	}
+
+	if (is_command(command, "s", "step")) {
+		print_stop(reverse, reverse_forward(reverse, number), out);
+	} else if (is_command(command, "c", "continue")) {
+		print_stop(reverse, reverse_forward(reverse, UINT64_MAX), out);
+	} else if (is_command(command, "rs", "reverse-step")) {
+		print_stop(reverse, reverse_back(reverse, number), out);
+	} else if (is_command(command, "rc", "reverse-continue")) {
+		print_stop(reverse, reverse_continue_back(reverse), out);
+	} else if (is_command(command, "g", "goto")) {
+		print_stop(reverse, reverse_goto(reverse, number), out);
+	} else if (is_command(command, "b", "break")) {
+		if (!reverse_break(reverse, number, true)) {
+			fprintf(out, "Too many breakpoints\n");
+		}
+	} else if (is_command(command, "d", "delete")) {
+		if (!reverse_break(reverse, number, false)) {
+			fprintf(out, "No breakpoint at 0x%08llx\n", (unsigned long long) number);
+		}
+	} else if (is_command(command, "w", "watch")) {
+		reverse_watch(reverse, count > 1 ? (int) number : REVERSE_NO_WATCH);
+	} else if (is_command(command, "p", "print")) {
+		print_registers(arm, out);
+	} else if (!strcmp(command, "x")) {
+		uint64_t words = 1;
+		if (count > 2 && !parse_number(args[2], &words)) {
+			fprintf(out, "Invalid argument %s\n", args[2]);
+			return true;
+		}
+		print_memory(arm, number, words, out);
+	} else if (!strcmp(command, "state")) {
+		fflush(out);
+		print_machine_status(arm, false);
+		fflush(stdout);
+	} else if (!strcmp(command, "info")) {
+		print_reverse_stats(reverse, out);
+	} else if (is_command(command, "q", "quit")) {
+		return false;
+	} else {
+		fprintf(out, "Unknown command %s\n", command);
+	}
+	return true;
+}
+
+int run_console(Reverse *reverse, FILE *in, FILE *out) {
+	struct sigaction action;
+	struct sigaction previous;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = interrupt;
+	action.sa_flags = SA_RESTART;
+	interrupted_reverse = reverse;
+	sigaction(SIGINT, &action, &previous);
+
+	char line[LINE_SIZE];
+	bool running = true;
+	while (running) {
+		fprintf(out, "(armemu) ");
+		fflush(out);
+		if (fgets(line, LINE_SIZE, in) == NULL) {
+			break;
+		}
+		char *args[MAX_ARGS];
+		int count = 0;
+		for (char *arg = strtok(line, " \t\n"); arg != NULL && count < MAX_ARGS; arg = strtok(NULL, " \t\n")) {
+			args[count++] = arg;
+		}
+		if (count > 0) {
+			running = run_command(reverse, args, count, out);
+		}
+	}
+
+	sigaction(SIGINT, &previous, NULL);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,33 @@
+#ifndef ARM11_18_CONSOLE_H
+#define ARM11_18_CONSOLE_H
+
+#include <stdio.h>
+#include "reverse.h"
+
+// --
+// -- Reverse debugging console
+// --
+// 'emulate --reverse' reads commands a line at a time, moving the machine
+// forward and back through its history (see reverse.h):
+//
+//   s, step [n]              run n instructions, 1 by default
+//   c, continue              run to a breakpoint, watched change or halt
+//   rs, reverse-step [n]     go back n instructions
+//   rc, reverse-continue     go back to the last breakpoint or watched change
+//   g, goto n                go to the state after n instructions
+//   b, break address         stop before the instruction at 'address'
+//   d, delete address
+//   w, watch rN              stop when rN changes; 'watch' alone stops watching
+//   p, print                 registers and step
+//   x address [n]            n memory words, 1 by default
+//   state                    the state as emulate prints it at the end
+//   info                     checkpoints kept
+//   q, quit
+//
+// Numbers are decimal, or hex with 0x. Each move prints where it stopped
+// and why; SIGINT stops a run in progress.
+
+// Read commands from 'in' until quit or end of file. Returns the exit code.
+int run_console(Reverse *reverse, FILE *in, FILE *out);
+
+#endif //ARM11_18_CONSOLE_H
@@ -3,7 +3,9 @@
 //
 #include "decode_helpers.h"
 #include "define_structures.h"
+#include "shifter.h"
 # include "emulator_processor.h"
+#include "host_perf.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -37,9 +39,16 @@
 #define LOAD_MASK 1 << 20
 #define OFFSET_TRANSFER_MASK 0xfff // for bits 0-11
 
+//for Block Data Transfer ONLY
+#define REGISTER_LIST_MASK 0xffff // for bits 0-15, r0-r15
+
 //for Branch ONLY
 #define OFFSET_BRANCH_MASK 0xFFFFFF //for bits 0-23
 
+//for Software Interrupt ONLY
+#define SWI_MASK 0xf << 24 //for bits 24-27
+#define COMMENT_SWI_MASK 0xFFFFFF //for bits 0-23
+
 //for Data Processing and Single Data Transfer
 #define IMMEDIATE_MASK 1 << 25
 #define RN_MASK 0xf //for bits 16-19
@@ -50,20 +59,6 @@
 //for Data Processing and Multiply
 #define SET_COND_CODES 1 << 20
 
-//Data processing
-
-#define IMM_MASK 0xff
-#define ROTATE_MASK (0xf << 8)
-#define SHIFT_MASK (0xff << 4)
-#define RM_MASK 0xf
-
-// Barrel shifter options
-
-#define LOGICAL_LEFT 0
-#define LOGICAL_RIGHT 1
-#define ARITHM_RIGHT 2
-#define ROTATE_RIGHT 3
-
 // -- FOR ALL TYPES OF INSTRUCTIONS
 
 // return condition bits
@@ -76,6 +71,9 @@ enum type get_instr_type(Instr *instruction) {
 	if(instruction->bits == 0) {
 		return HALT;
 	}
+	if ((SWI_MASK & instruction->bits) == SWI_MASK) {
+		return SEMIHOST;
+	}
 	if ((1 << 27) & instruction->bits) {
 		if((1 << 25) & instruction->bits) {
 			return BRANCH;
@@ -163,6 +161,11 @@ int32_t get_offset_BRANCH(Instr *instruction) {
 	return (OFFSET_BRANCH_MASK & instruction->bits);
 }
 
+// -- SOFTWARE INTERRUPT ONLY
+uint32_t get_comment_SWI(Instr *instruction) {
+	return COMMENT_SWI_MASK & instruction->bits;
+}
+
 // -- DATA PROCESSING AND MULTIPLY ONLY
 // check Immediate bit
 bool is_immediate(Instr *instruction) {
@@ -186,7 +189,7 @@ uint32_t get_rd(Instr *instruction) {
 // return Register List
 
 uint16_t get_register_list(Instr *instruction){
-	return (OFFSET_TRANSFER_MASK) &instruction->bits;
+	return (REGISTER_LIST_MASK) &instruction->bits;
 }
 
 
@@ -209,34 +212,24 @@ void print_bits(uint32_t val){
 	printf("\n");
 }
 
-uint32_t decode_offset(uint32_t offset,bool imm,Machine* arm){
-	uint32_t op2;
-	if(imm) {
-		// immediate value
-		op2 = offset & IMM_MASK;
-		uint8_t rotate = (offset & ROTATE_MASK) >> 8;
-		op2 = barrel_shift(op2,2*rotate,ROTATE_RIGHT,arm);
-	}
-	else {
-		// shifter register value
-		uint32_t shift = (offset & SHIFT_MASK) >> 4;
-		uint8_t rm = offset & RM_MASK;
-		uint32_t val = arm->general_reg[rm];
-
-		if(!(shift & 1)) {
-			// constant ammounts
-			uint8_t amm = ((0x1f << 3) & shift) >> 3;
-			uint8_t type = ((0x3 << 1) & shift) >> 1;
-			op2 = barrel_shift(val,amm,type,arm);
-		}
-		else {
-			// ammount specifies by a register
-			uint8_t rs = ((0xf << 4) & shift) >> 4;
-			uint8_t type = ((0x3 << 1) & shift) >> 1;
-			uint8_t amm = arm->general_reg[rs] & 0xff;
-			op2 = barrel_shift(val,amm,type,arm);
-		}
+// The carry goes into the shifter as the C flag, for shifts that keep it and RRX
+
+uint32_t decode_offset(uint32_t offset,Machine* arm){
+	HOST_STAGE(arm, STAGE_OPERAND);
+	arm->shifter_carry = (arm->cpsr_reg & C_MASK) != 0;
+	uint32_t rm = arm->general_reg[offset & RM_MASK];
+	uint32_t rs = offset & SHIFT_BY_REGISTER ? arm->general_reg[shift_register(offset)] : 0;
+	uint32_t value = shift_operand(offset, rm, rs, &arm->shifter_carry);
+	HOST_STAGE(arm, STAGE_EXECUTE);
+	return value;
+}
+
+uint32_t decode_operand2(Decoded_Instr *instr,Machine* arm){
+	if(!instr->imm) {
+		return decode_offset(instr->operand.op2, arm);
 	}
+	uint32_t op2 = instr->operand.op2;
+	arm->shifter_carry = instr->accum ? op2 >> 31 : (arm->cpsr_reg & C_MASK) != 0;
 	return op2;
 }
 
@@ -251,9 +244,8 @@ void print_instr(Decoded_Instr *instr){
 		printf("RN:%x ",instr->rn);
 		printf("RD:%x ",instr->rd);
 		printf("IMM:%x ",instr->imm);
-		printf("OP2:%x ",instr->op2);
-		printf("OFFSET_OP2: ");
-		print_bits(instr->offset);
+		printf("OP2: ");
+		print_bits(instr->operand.op2);
 		printf("OPCODE:%x ",instr->opcode);
 		printf("SET:%x ",instr->set);
 		return;
@@ -262,8 +254,8 @@ void print_instr(Decoded_Instr *instr){
 		printf("COND:%x ",instr->cond);
 		printf("RN:%x ",instr->rn);
 		printf("RD:%x ",instr->rd);
-		printf("RM:%x ",instr->op2);
-		printf("RS:%x ",instr->opcode);
+		printf("RM:%x ",instr->operand.mul.rm);
+		printf("RS:%x ",instr->operand.mul.rs);
 		printf("ACCUM:%x ",instr->accum);
 		printf("SET:%x ",instr->set);
 		return;
@@ -277,12 +269,12 @@ void print_instr(Decoded_Instr *instr){
 		printf("SET:%x ",instr->set);
 		printf("LOAD:%x ",instr->load);
 		printf("UP:%x ",instr->up);
-		printf("OFFSET:%x ",instr->offset);
+		printf("OFFSET:%x ",instr->operand.offset);
 		return;
 	case BRANCH:
 		printf("BRANCH\n");
-		printf("COND:%x",instr->cond);
-		printf("OFFSET:%x ",instr->offset);
+		printf("COND:%x ",instr->cond);
+		printf("OFFSET:%d ",instr->operand.sgn_offset);
 		return;
 	case MULTI_TRANSFER:
 		printf("MULTI TRANSFER\n");
@@ -294,7 +286,7 @@ void print_instr(Decoded_Instr *instr){
 		printf("LOAD:%x ",instr->load);
 		printf("UP:%x ",instr->up);
 		printf("REGLIST: ");
-		print_bits(instr->register_list);
+		print_bits(instr->operand.register_list);
 		return;
 	case NOOP:
 		return;
@@ -303,43 +295,68 @@ void print_instr(Decoded_Instr *instr){
 
 // print machine status according to test format
 
-void print_machine_status(Machine *arm,bool stack_mode){
-	printf("Registers:\n");
+static char *put_hex(char *out, uint32_t val, int digits) {
+	static const char hex[] = "0123456789abcdef";
+	for (int i = digits - 1; i >= 0; i--) {
+		out[i] = hex[val & 0xf];
+		val >>= 4;
+	}
+	return out + digits;
+}
+
+// "0x%08x: 0x%02x%02x%02x%02x\n", the word's bytes in memory order
+static char *put_memory_word(char *out, Machine *arm, uint32_t address) {
+	uint32_t bytes = (uint32_t) arm->memory[address] << 24 | (uint32_t) arm->memory[address + 1] << 16
+	                 | (uint32_t) arm->memory[address + 2] << 8 | arm->memory[address + 3];
+	*out++ = '0';
+	*out++ = 'x';
+	out = put_hex(out, address, 8);
+	*out++ = ':';
+	*out++ = ' ';
+	*out++ = '0';
+	*out++ = 'x';
+	out = put_hex(out, bytes, 8);
+	*out++ = '\n';
+	return out;
+}
+
+size_t format_machine_status(Machine *arm,bool stack_mode,char *buffer){
+	char *out = buffer;
+	out += sprintf(out,"Registers:\n");
 	for(int i = 0; i < 13; i++) {
-		printf("$%-2d : %10d (0x%08x)\n",i,arm->general_reg[i],arm->general_reg[i]);
+		out += sprintf(out,"$%-2d : %10d (0x%08x)\n",i,arm->general_reg[i],arm->general_reg[i]);
 	}
 	if(stack_mode) {
-		printf("SP  : %*u (0x%08x)\n",10,arm->general_reg[SP_REG],arm->general_reg[SP_REG]);
-		printf("LR  : %*u (0x%08x)\n",10,arm->general_reg[LR_REG],arm->general_reg[LR_REG]);
+		out += sprintf(out,"SP  : %*u (0x%08x)\n",10,arm->general_reg[SP_REG],arm->general_reg[SP_REG]);
+		out += sprintf(out,"LR  : %*u (0x%08x)\n",10,arm->general_reg[LR_REG],arm->general_reg[LR_REG]);
 	}
-	printf("PC  : %*d (0x%08x)\n",10,arm->pc_reg,arm->pc_reg);
-	printf("CPSR: %*d (0x%08x)\n",10,arm->cpsr_reg,arm->cpsr_reg);
-//	printf("CARRY: (0x%08x)\n",arm->shifter_carry);
+	out += sprintf(out,"PC  : %*d (0x%08x)\n",10,arm->pc_reg,arm->pc_reg);
+	out += sprintf(out,"CPSR: %*d (0x%08x)\n",10,arm->cpsr_reg,arm->cpsr_reg);
 
-	int val;
-	printf("Non-zero memory:\n");
+	uint32_t val;
+	out += sprintf(out,"Non-zero memory:\n");
 	if(!stack_mode) {
 		for(int i = 0; i < MEMORY_SIZE / 4; i++) {
 			memcpy(&val,&arm->memory[4 * i],4);
-			uint8_t b0 = arm->memory[4 * i];
-			uint8_t b1 = arm->memory[4 * i + 1];
-			uint8_t b2 = arm->memory[4 * i + 2];
-			uint8_t b3 = arm->memory[4 * i + 3];
 			if(val) {
-				printf("0x%08x: 0x%02x%02x%02x%02x\n",4*i,b0,b1,b2,b3);
+				out = put_memory_word(out,arm,4 * i);
 			}
 		}
 	}
 	else {
 		for(int i = MEMORY_SIZE / 4 - 1; i >= 0; i--) {
 			memcpy(&val,&arm->memory[4 * i],4);
-			uint8_t b0 = arm->memory[4 * i];
-			uint8_t b1 = arm->memory[4 * i + 1];
-			uint8_t b2 = arm->memory[4 * i + 2];
-			uint8_t b3 = arm->memory[4 * i + 3];
 			if(val) {
-				printf("0x%08x: 0x%02x%02x%02x%02x\n",4*i,b0,b1,b2,b3);
+				out = put_memory_word(out,arm,4 * i);
 			}
 		}
 	}
+	return out - buffer;
+}
+
+void print_machine_status(Machine *arm,bool stack_mode){
+	char *buffer = malloc(MACHINE_STATUS_MAX_SIZE);
+	size_t length = format_machine_status(arm,stack_mode,buffer);
+	fwrite(buffer,1,length,stdout);
+	free(buffer);
 }
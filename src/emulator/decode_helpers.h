@@ -58,6 +58,11 @@ uint32_t get_offset_TRANSFER(Instr *instruction);
 int32_t get_offset_BRANCH(Instr *instruction);
 
 
+//FOR SOFTWARE INTERRUPT ONLY
+//get the comment field, the semihosting call number
+uint32_t get_comment_SWI(Instr *instruction);
+
+
 //FOR DATA PROCESSING AND MULTIPLY ONLY
 //check Immediate bit
 bool is_immediate(Instr *instruction);
@@ -80,9 +85,14 @@ bool is_set(Instr *instruction);
 uint16_t get_register_list(Instr *instruction);
 
 // -- decodes the shifted register value provided in data processing
-// and data transfer instructions
+// and data transfer instructions, setting the shifter carry
+
+uint32_t decode_offset(uint32_t offset,Machine* arm);
 
-uint32_t decode_offset(uint32_t offset,bool imm,Machine* arm);
+// -- operand2 of a data processing instruction, immediates come rotated
+// from decode()
+
+uint32_t decode_operand2(Decoded_Instr *instr,Machine* arm);
 
 // --
 // -- Printing and debug helpers
@@ -94,4 +104,11 @@ void print_instr(Decoded_Instr *instr);
 
 void print_machine_status(Machine *arm,bool stack_mode);
 
+// Longest status: the registers, then a line for every memory word
+#define MACHINE_STATUS_MAX_SIZE (1024 + (MEMORY_SIZE / 4) * 23)
+
+// Write the status print_machine_status() prints to 'buffer', of at least
+// MACHINE_STATUS_MAX_SIZE bytes. Returns the bytes written.
+size_t format_machine_status(Machine *arm,bool stack_mode,char *buffer);
+
 #endif //ARM11_18_DECODE_HELPERS_H
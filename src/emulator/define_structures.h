@@ -7,8 +7,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "armemu.h"
+
 #define ARM11_18_DEFINE_TYPES_H
 #define MEMORY_SIZE (1 << 16)
+#define TRAP_PAGE_SHIFT 10 // 64 pages, a bit each in Machine.trapped_pages
 #define GENERAL_REGISTERS_NUM 15
 
 #define SP_REG 13
@@ -17,17 +20,6 @@
 
 #define PIPELINE_OFFSET 8
 
-struct Machine {
-	uint8_t memory[MEMORY_SIZE];
-	uint32_t general_reg[GENERAL_REGISTERS_NUM];
-	uint32_t cpsr_reg;
-	uint32_t pc_reg;
-	uint32_t sp_reg; // stack pointer
-	bool end;
-	bool branch_executed;
-	uint8_t shifter_carry;
-	uint32_t stack_limit;
-};
 typedef struct Machine Machine;
 
 typedef uint32_t (*ProcFunc)(uint32_t,uint32_t,bool,Machine*);
@@ -35,11 +27,20 @@ typedef uint32_t (*ProcFunc)(uint32_t,uint32_t,bool,Machine*);
 enum cond {
 	eq = 0x0, // 0000
 	ne = 0x1, // 0001
+	cs = 0x2, // 0010
+	cc = 0x3, // 0011
+	mi = 0x4, // 0100
+	pl = 0x5, // 0101
+	vs = 0x6, // 0110
+	vc = 0x7, // 0111
+	hi = 0x8, // 1000
+	ls = 0x9, // 1001
 	ge = 0xa, // 1010
 	lt = 0xb, // 1011
 	gt = 0xc, // 1100
 	le = 0xd, // 1101
-	al = 0xe  // 1110
+	al = 0xe, // 1110
+	nv = 0xf  // 1111
 };
 
 enum type {
@@ -49,39 +50,81 @@ enum type {
 	TRANSFER,
 	BRANCH,
 	MULTI_TRANSFER,
-	NOOP = 0xffff // was 0xffffffff but enum should be int (32 bit)
+	SEMIHOST,  // swi, a call run natively by the emulator
+	NOOP = 0x7 // largest value the 3 bit type field holds
+};
+
+// Data processing opcodes
+
+enum opcode {
+	OPCODE_AND = 0x0,
+	OPCODE_EOR = 0x1,
+	OPCODE_SUB = 0x2,
+	OPCODE_RSB = 0x3,
+	OPCODE_ADD = 0x4,
+	OPCODE_TST = 0x8,
+	OPCODE_TEQ = 0x9,
+	OPCODE_CMP = 0xa,
+	OPCODE_ORR = 0xc,
+	OPCODE_MOV = 0xd
+};
+
+// Groups of instructions executed by a single fused handler
+
+enum fusion {
+	NO_FUSION,
+	FUSE_SPIN,              // b .
+	FUSE_COUNTED_CMP_LOOP,  // loop: sub rX,rX,#n; cmp rX,#c; b<cond> loop
+	FUSE_COUNTED_LOOP,      // loop: subs rX,rX,#n; b<cond> loop
+	FUSE_SUB_CMP_BRANCH,    // sub rX,rX,#n; cmp rX,op2; b<cond>
+	FUSE_CMP_BRANCH,        // cmp rn,op2; b<cond>
+	FUSE_SUB_BRANCH,        // sub rX,rX,#n; b<cond>
+	FUSE_LDR_ADD,           // ldr; add
+	FUSIONS_NUM
 };
+
+#define FUSION_MAX_LENGTH 3
+
+// Decoded instruction packed in 8 bytes: a word of bitfields shared by all
+// types, and a word holding the operand of the instruction's own type.
+
 struct Decoded_Instr {
-	bool exists;
-	enum cond cond;
-	enum type type;   // 4 main types of instr + noop
-	uint8_t rn;
-	uint8_t rd;
-	uint32_t offset;
-	bool set;
+	unsigned int exists : 1;
+	unsigned int type : 3;          // enum type
+	unsigned int cond : 4;          // enum cond
+	unsigned int conditional : 1;   // cond is not al, checked before execution
+	unsigned int rn : 4;
+	unsigned int rd : 4;
 
 	// data processing
-	uint8_t opcode;
-	uint32_t op2;
+	unsigned int opcode : 4;
+	unsigned int set : 1;           // also multiply; on a halt, a breakpoint
+	unsigned int imm : 1;           // also data transfer
 
 	//multiply
-	bool accum;
-	uint32_t rm;
-	uint32_t rs;
+	unsigned int accum : 1;         // also data processing: immediate rotated, C from its bit 31
 
 	// data transfer
-	bool imm;
-	bool pre_index;
-	bool write_back; // both transfers
-	bool load;
-	bool up;
-
-	// branch
-	int32_t sgn_offset;
-
-	// stack
-	uint16_t register_list;
-
+	unsigned int pre_index : 1;
+	unsigned int write_back : 1;    // both transfers
+	unsigned int load : 1;
+	unsigned int up : 1;
+
+	// fused group starting at this instruction
+	unsigned int fusion : 3;        // enum fusion
+	unsigned int fusion_checked : 1;
+
+	union {
+		uint32_t op2;           // data processing: operand2 field, or the rotated immediate
+		uint32_t offset;        // data transfer: offset field
+		struct {
+			uint8_t rm;
+			uint8_t rs;
+		} mul;
+		int32_t sgn_offset;     // branch: byte offset, sign extended
+		uint16_t register_list; // stack
+		uint32_t call;          // semihosting: enum semihost_call
+	} operand;
 };
 typedef struct Decoded_Instr Decoded_Instr;
 
@@ -91,4 +134,71 @@ struct Instr {
 };
 typedef struct Instr Instr;
 
+struct Watchpoint {
+	uint32_t address;
+	uint32_t length;
+};
+typedef struct Watchpoint Watchpoint;
+
+struct Mmio_Region {
+	uint32_t start;
+	uint32_t size;
+	armemu_mmio_read read;
+	armemu_mmio_write write;
+	void *device;
+};
+typedef struct Mmio_Region Mmio_Region;
+
+// Machines are allocated ARMEMU_MACHINE_ALIGN aligned (see armemu.c), so
+// the registers and run state read or written by every instruction share
+// the first two cache lines, apart from guest memory and the decode cache.
+
+struct Machine {
+	uint32_t general_reg[GENERAL_REGISTERS_NUM];
+	uint32_t cpsr_reg;
+	uint32_t pc_reg;
+	uint32_t stack_limit;
+	uint64_t steps;   // executed instructions
+	bool end;
+	bool branch_executed;
+	uint8_t shifter_carry;
+	bool fusion;      // run fused groups through one handler
+	enum armemu_fault fault;
+	uint32_t fault_addr;
+	uint32_t sp_reg; // stack pointer
+	bool report_errors; // print non fatal errors as they happen
+
+	ProcFunc data_proc_func[14];
+	uint64_t fusion_hits[FUSIONS_NUM];
+
+	// decode cache, one entry per memory word, cleared by stores
+	Decoded_Instr predecoded[MEMORY_SIZE / 4];
+	uint8_t memory[MEMORY_SIZE];
+
+	// devices mapped outside guest memory
+	Mmio_Region mmio[ARMEMU_MAX_DEVICES];
+	uint8_t mmio_count;
+
+	// breakpoints, tagged into 'predecoded', and watchpoints, with a bit
+	// for each page either is in
+	uint32_t breakpoints[ARMEMU_MAX_BREAKPOINTS];
+	uint8_t breakpoint_count;
+	Watchpoint watchpoints[ARMEMU_MAX_WATCHPOINTS];
+	uint8_t watchpoint_count;
+	uint64_t trapped_pages;
+
+#ifdef ARMEMU_TIMING
+	struct Timing *timing; // performance model fed by the run, if any
+#endif
+#ifdef ARMEMU_HOST_PERF
+	struct Host_Perf *host_perf; // host counters profiling the run, if any
+#endif
+#ifdef ARMEMU_FUZZ
+	struct Fuzz *fuzz; // coverage-guided fuzzer running the image, if any
+#endif
+#ifdef ARMEMU_REVERSE
+	struct Reverse *reverse; // history checkpointed for reverse execution, if any
+#endif
+};
+
 #endif //ARM11_18_DEFINE_TYPES_H
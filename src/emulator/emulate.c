@@ -2,13 +2,421 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
-#include <math.h>
 #include <stdbool.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
 
-#include "emulator_processor.h"
+#include "armemu.h"
 #include "decode_helpers.h"
 #include "define_structures.h"
+#include "state_dump.h"
+#include "gpio.h"
+#include "fusion.h"
+#include "simt.h"
+#include "timing.h"
+#include "host_perf.h"
+#include "serve.h"
+#include "batch_io.h"
+#include "fuzz.h"
+#include "reverse.h"
+#include "console.h"
+#include "gdbstub.h"
 
+#define OUTPUT_OPTION "--output="
+#define MAX_STEPS_OPTION "--max-steps="
+#define MAX_WALL_MS_OPTION "--max-wall-ms="
+#define NO_FUSION_OPTION "--no-fusion"
+#define FUSION_STATS_OPTION "--fusion-stats"
+#define SWEEP_OPTION "--sweep="
+#define TIMING_OPTION "--timing"
+#define ICACHE_OPTION "--icache="
+#define DCACHE_OPTION "--dcache="
+#define PREDICTOR_OPTION "--predictor="
+#define HOST_PERF_OPTION "--host-perf"
+#define SERVE_OPTION "--serve="
+#define THREADS_OPTION "--threads="
+#define BATCH_OPTION "--batch="
+#define NO_URING_OPTION "--no-uring"
+#define FUZZ_OPTION "--fuzz="
+#define FUZZ_RUNS_OPTION "--fuzz-runs="
+#define FUZZ_SEED_OPTION "--fuzz-seed="
+#define FUZZ_OUT_OPTION "--fuzz-out="
+#define REVERSE_OPTION "--reverse"
+#define REVERSE_INTERVAL_OPTION "--reverse-interval="
+#define REVERSE_BUDGET_OPTION "--reverse-budget="
+#define GDB_OPTION "--gdb="
+
+// exit codes when a run is cut short, after dumping the partial state
+#define EXIT_STEP_LIMIT 3
+#define EXIT_TIME_LIMIT 4
+
+// usage: emulate [--output=text|json|binary] [--max-steps=N] [--max-wall-ms=N]
+//                [--no-fusion] [--fusion-stats] [--sweep=rN:first:count]
+//                [--timing] [--icache=size:line:ways] [--dcache=size:line:ways]
+//                [--predictor=entries] [--host-perf] file
+//        emulate --serve=socket [--threads=N] [--max-steps=N] [--max-wall-ms=N]
+//        emulate --batch=directory [--no-uring] [--output=text|json|binary]
+//                [--max-steps=N] [--max-wall-ms=N] [--no-fusion]
+//        emulate --fuzz=address:size [--fuzz-runs=N] [--fuzz-seed=N]
+//                [--fuzz-out=directory] [--max-steps=N] file
+//        emulate --reverse [--reverse-interval=N] [--reverse-budget=MB] file
+//        emulate --gdb=:port|socket [--no-fusion] file
+//
+// Programs are flat binaries, or sectioned images as 'assemble -s' writes
+// them (see armemu.h), everywhere but in sweeps.
+//
+// --sweep runs 'count' instances of the program in SIMT lanes, instance i
+// starting with rN = first + i, and prints the final state of each in
+// turn. Sweeps have no GPIO and no time limit.
+//
+// --timing runs the program through the cache, branch predictor and
+// pipeline model and reports the estimated cycles of each basic block and
+// the misses per instruction to stderr; the cache and predictor options
+// imply it. Sizes are in bytes,
+// or KB with a 'k' suffix. Needs an emulator built with 'make TIMING=1'.
+//
+// --host-perf profiles the emulator rather than the guest: host cycles,
+// instructions, branch and L1D misses per emulated instruction, by
+// emulator stage and by guest basic block, to stderr. Needs an emulator
+// built with 'make HOST_PERF=1'.
+//
+// --serve runs as a daemon taking jobs on a Unix socket (see serve.h),
+// on one worker per CPU unless --threads is given. The limits apply to
+// jobs not setting their own. 'loadgen' measures its latency.
+//
+// --batch runs every file in the directory, in name order, and prints the
+// final state of each in turn, the images being read ahead and the states
+// written while the next ones run (see batch_io.h). Batches have no GPIO,
+// and report only the last out of bounds access, as sweeps do.
+// --no-uring does the I/O from threads even where io_uring is available.
+//
+// --fuzz runs the program on inputs mutated to reach new code, written to
+// the 'size' bytes at 'address', both multiples of 4, with r0 holding the
+// input length and r1 its address (see fuzz.h). Runs are limited to
+// 100000 steps unless --max-steps is given; crashes and the corpus are
+// saved to the --fuzz-out directory. The report goes to stdout, and the
+// exit code is 1 if anything crashed. Needs an emulator built with
+// 'make FUZZ=1'.
+//
+// --reverse loads the program and hands it to a debugging console on
+// stdin that can step and continue backwards as well as forwards (see
+// console.h). A checkpoint is taken every 100000 instructions unless
+// --reverse-interval is given, and the checkpoints are kept within
+// --reverse-budget MB, 64 by default. No GPIO, as going back runs the
+// program again. Needs an emulator built with 'make REVERSE=1'.
+//
+// --gdb loads the program and waits for GDB to connect, with 'target
+// remote :port' to a TCP port on 127.0.0.1 or 'target remote socket' to a
+// Unix socket, and debugs it from there (see gdbstub.h). GPIO events go
+// to stdout.
+
+// files named ...stack?? are dumped with SP and LR, memory top down
+static bool is_stack_file(const char *filename) {
+	int n = strlen(filename);
+	return n >= 7 && strncmp("stack",&filename[n - 7],5) == 0;
+}
+
+static const char *load_error(const Machine *arm) {
+	if (armemu_fault(arm) == ARMEMU_BAD_IMAGE) {
+		return "Malformed sectioned image";
+	}
+	return "Instructions exceeded memory size";
+}
+
+static bool has_option(const char *arg, const char *option) {
+	return !strncmp(arg, option, strlen(option));
+}
+
+static uint64_t parse_limit(const char *arg, const char *option) {
+	char *end;
+	uint64_t val = strtoull(arg + strlen(option), &end, 10);
+	if (*end != '\0' || end == arg + strlen(option)) {
+		fprintf(stderr,"Invalid value for %s",option);
+		exit(EXIT_FAILURE);
+	}
+	return val;
+}
+
+static bool parse_fuzz_region(const char *arg, Fuzz_Config *config) {
+	char *end;
+	config->address = strtoul(arg, &end, 0);
+	if (*end != ':' || end == arg) {
+		return false;
+	}
+	arg = end + 1;
+	config->size = strtoul(arg, &end, 0);
+	return *end == '\0' && end != arg;
+}
+
+struct Sweep {
+	uint32_t reg;
+	uint32_t first;
+	uint32_t count;
+};
+typedef struct Sweep Sweep;
+
+static bool parse_sweep(const char *arg, Sweep *sweep) {
+	char *end;
+	if (*arg++ != 'r') {
+		return false;
+	}
+	sweep->reg = strtoul(arg, &end, 10);
+	if (*end != ':' || end == arg || sweep->reg >= GENERAL_REGISTERS_NUM) {
+		return false;
+	}
+	arg = end + 1;
+	sweep->first = strtoul(arg, &end, 0);
+	if (*end != ':' || end == arg) {
+		return false;
+	}
+	arg = end + 1;
+	sweep->count = strtoul(arg, &end, 10);
+	return *end == '\0' && end != arg && sweep->count > 0;
+}
+
+static bool parse_size(const char *arg, char **end, uint32_t *size) {
+	*size = strtoul(arg, end, 10);
+	if (*end == arg) {
+		return false;
+	}
+	if (**end == 'k' || **end == 'K') {
+		*size *= 1024;
+		(*end)++;
+	}
+	return true;
+}
+
+static bool parse_cache(const char *arg, Cache_Config *cache) {
+	char *end;
+	if (!parse_size(arg, &end, &cache->size) || *end != ':') {
+		return false;
+	}
+	if (!parse_size(end + 1, &end, &cache->line) || *end != ':') {
+		return false;
+	}
+	arg = end + 1;
+	cache->ways = strtoul(arg, &end, 10);
+	return *end == '\0' && end != arg;
+}
+
+// Run the instances of a sweep SIMT_LANES at a time. Returns the exit code.
+
+static int run_sweep(const uint8_t *image, size_t image_size, Sweep *sweep,
+                     enum output_format format, bool stack_mode, uint64_t max_steps) {
+	Simt *simt = simt_create();
+	Machine *arm = armemu_create();
+	if (simt == NULL || arm == NULL) {
+		fprintf(stderr,"Could not allocate the machine");
+		exit(EXIT_FAILURE);
+	}
+	int status = EXIT_SUCCESS;
+
+	for (uint32_t batch = 0; batch < sweep->count; batch += SIMT_LANES) {
+		uint32_t lanes = sweep->count - batch < SIMT_LANES ? sweep->count - batch : SIMT_LANES;
+		if (!simt_load(simt,image,image_size)) {
+			fprintf(stderr,"Instructions exceeded memory size");
+			exit(EXIT_FAILURE);
+		}
+		for (uint32_t l = 0; l < lanes; l++) {
+			simt->reg[sweep->reg][l] = sweep->first + batch + l;
+		}
+		simt->running &= lanes == 32 ? 0xffffffff : (1u << lanes) - 1;
+		simt_run(simt,max_steps);
+
+		for (uint32_t l = 0; l < lanes; l++) {
+			uint32_t value = sweep->first + batch + l;
+			simt_lane_state(simt,l,arm);
+			switch(arm->fault) {
+			case ARMEMU_PC_OUT_OF_RANGE:
+				fprintf(stderr,"r%u = %u: PC exceeded memory size\n",sweep->reg,value);
+				status = EXIT_FAILURE;
+				break;
+			case ARMEMU_STACK_LIMIT:
+				fprintf(stderr,"r%u = %u: Error: Illegal memory access: stack limit exceeded\n",sweep->reg,value);
+				status = EXIT_FAILURE;
+				break;
+			case ARMEMU_STEP_LIMIT:
+				fprintf(stderr,"r%u = %u: Step limit reached\n",sweep->reg,value);
+				if (status == EXIT_SUCCESS) {
+					status = EXIT_STEP_LIMIT;
+				}
+				break;
+			default:
+				break;
+			}
+
+			switch(format) {
+			case OUTPUT_JSON:
+				dump_json(arm,stdout);
+				break;
+			case OUTPUT_BINARY:
+				dump_binary(arm,stdout);
+				break;
+			default:
+				printf("Instance r%u = %u\n",sweep->reg,value);
+				if (arm->fault == ARMEMU_OUT_OF_BOUNDS) {
+					printf("Error: Out of bounds memory access at address 0x%08x\n",arm->fault_addr);
+				}
+				print_machine_status(arm,stack_mode);
+			}
+		}
+	}
+
+	armemu_destroy(arm);
+	simt_destroy(simt);
+	return status;
+}
+
+// Run every file in a directory. Returns the exit code.
+
+#define BATCH_HEADER_SIZE 512  // "Image name" and an out of bounds error
+
+static int is_image(const struct dirent *entry) {
+	return entry->d_name[0] != '.' && entry->d_type != DT_DIR;
+}
+
+static int run_batch(const char *directory, enum output_format format, uint64_t max_steps,
+                     uint64_t max_wall_ms, bool fusion, bool threads) {
+	struct dirent **entries;
+	int count = scandir(directory, &entries, is_image, alphasort);
+	if (count < 0) {
+		fprintf(stderr,"Directory could not be read");
+		exit(EXIT_FAILURE);
+	}
+	char **paths = malloc(count * sizeof(char *));
+	for (int i = 0; i < count; i++) {
+		paths[i] = malloc(strlen(directory) + strlen(entries[i]->d_name) + 2);
+		sprintf(paths[i],"%s/%s",directory,entries[i]->d_name);
+	}
+
+	Batch_Io *io = batch_io_create(paths,count,STDOUT_FILENO,BATCH_HEADER_SIZE + STATE_MAX_SIZE,threads);
+	Machine *arm = armemu_create();
+	if (io == NULL || arm == NULL) {
+		fprintf(stderr,"Could not allocate the machine");
+		exit(EXIT_FAILURE);
+	}
+	armemu_set_fusion(arm,fusion);
+	int status = EXIT_SUCCESS;
+
+	Batch_Image *image;
+	while ((image = batch_io_next(io)) != NULL) {
+		const char *name = entries[image->index]->d_name;
+		if (image->error) {
+			fprintf(stderr,"%s: %s\n",name,strerror(image->error));
+			status = EXIT_FAILURE;
+			batch_io_release(io,image);
+			continue;
+		}
+		bool loaded = armemu_reload(arm,image->data,image->size);
+		batch_io_release(io,image);
+		if (!loaded) {
+			fprintf(stderr,"%s: %s\n",name,load_error(arm));
+			status = EXIT_FAILURE;
+			continue;
+		}
+		if (max_steps || max_wall_ms) {
+			armemu_run_limited(arm,max_steps,max_wall_ms);
+		} else {
+			armemu_run(arm);
+		}
+
+		switch(arm->fault) {
+		case ARMEMU_PC_OUT_OF_RANGE:
+			fprintf(stderr,"%s: PC exceeded memory size\n",name);
+			status = EXIT_FAILURE;
+			break;
+		case ARMEMU_STACK_LIMIT:
+			fprintf(stderr,"%s: Error: Illegal memory access: stack limit exceeded\n",name);
+			status = EXIT_FAILURE;
+			break;
+		case ARMEMU_STEP_LIMIT:
+			fprintf(stderr,"%s: Step limit reached\n",name);
+			if (status == EXIT_SUCCESS) {
+				status = EXIT_STEP_LIMIT;
+			}
+			break;
+		case ARMEMU_TIME_LIMIT:
+			fprintf(stderr,"%s: Time limit reached\n",name);
+			if (status == EXIT_SUCCESS) {
+				status = EXIT_TIME_LIMIT;
+			}
+			break;
+		default:
+			break;
+		}
+
+		uint8_t *out = batch_io_output(io);
+		size_t length = 0;
+		if (format == OUTPUT_TEXT) {
+			length += snprintf((char *) out,BATCH_HEADER_SIZE,"Image %.255s\n",name);
+			if (arm->fault == ARMEMU_OUT_OF_BOUNDS) {
+				length += sprintf((char *) out + length,"Error: Out of bounds memory access at address 0x%08x\n",arm->fault_addr);
+			}
+		}
+		length += format_state(arm,format,is_stack_file(name),out + length);
+		batch_io_write(io,out,length);
+	}
+
+	if (!batch_io_destroy(io)) {
+		fprintf(stderr,"Results could not be written");
+		status = EXIT_FAILURE;
+	}
+	armemu_destroy(arm);
+	for (int i = 0; i < count; i++) {
+		free(paths[i]);
+		free(entries[i]);
+	}
+	free(paths);
+	free(entries);
+	return status;
+}
+
+// Fuzz the image loaded in 'arm'. Returns the exit code.
+static int run_fuzz(Machine *arm, const Fuzz_Config *config) {
+	Fuzz *fuzz = fuzz_create(config);
+	if (fuzz == NULL) {
+		fprintf(stderr,"Invalid fuzz input region, must be word aligned and inside memory");
+		exit(EXIT_FAILURE);
+	}
+	if (!fuzz_run(fuzz,arm,stderr)) {
+		fprintf(stderr,"Fuzzing not built in, rebuild with make FUZZ=1");
+		exit(EXIT_FAILURE);
+	}
+	print_fuzz_report(fuzz,stdout);
+	int status = fuzz->crash_count ? EXIT_FAILURE : EXIT_SUCCESS;
+	fuzz_destroy(fuzz);
+	armemu_destroy(arm);
+	return status;
+}
+
+// Debug the image loaded in 'arm' from the console. Returns the exit code.
+static int run_reverse(Machine *arm, const Reverse_Config *config) {
+	Reverse *reverse = reverse_create(config);
+	if (reverse == NULL) {
+		fprintf(stderr,"Could not allocate the checkpoints");
+		exit(EXIT_FAILURE);
+	}
+	if (!reverse_attach(reverse,arm)) {
+		fprintf(stderr,"Reverse execution not built in, rebuild with make REVERSE=1");
+		exit(EXIT_FAILURE);
+	}
+	int status = run_console(reverse,stdin,stdout);
+	reverse_destroy(reverse);
+	armemu_destroy(arm);
+	return status;
+}
+
+// Debug the image loaded in 'arm' from GDB. Returns the exit code.
+static int run_gdb(Machine *arm, const char *address, bool fusion) {
+	armemu_set_fusion(arm,fusion);
+	Gpio gpio;
+	gpio_attach(&gpio,arm,stdout);
+	int status = gdb_serve(arm,address);
+	gpio_flush(&gpio);
+	armemu_destroy(arm);
+	return status;
+}
 
 int main(int argc, char **argv) {
 
@@ -16,106 +424,295 @@ int main(int argc, char **argv) {
 	//
 	FILE *input;
 	bool stack_mode = false;
+	enum output_format format = OUTPUT_TEXT;
+	char *filename = NULL;
+	uint64_t max_steps = 0;
+	uint64_t max_wall_ms = 0;
+	bool fusion = true;
+	bool fusion_stats = false;
+	bool sweep_mode = false;
+	Sweep sweep = {0, 0, 0};
+	bool timing_mode = false;
+	Timing_Config timing_config = timing_default_config;
+	bool host_perf_mode = false;
+	Serve_Config serve_config = {NULL, 0, 0, 0};
+	const char *batch_directory = NULL;
+	bool no_uring = false;
+	bool fuzz_mode = false;
+	Fuzz_Config fuzz_config = {0, 0, FUZZ_DEFAULT_RUNS, 0, time(NULL), NULL};
+	bool reverse_mode = false;
+	Reverse_Config reverse_config = {REVERSE_DEFAULT_INTERVAL, REVERSE_DEFAULT_BUDGET};
+	const char *gdb_address = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (has_option(argv[i], OUTPUT_OPTION)) {
+			if (!parse_output_format(argv[i] + strlen(OUTPUT_OPTION), &format)) {
+				fprintf(stderr,"Unknown output format");
+				exit(EXIT_FAILURE);
+			}
+		} else if (has_option(argv[i], MAX_STEPS_OPTION)) {
+			max_steps = parse_limit(argv[i], MAX_STEPS_OPTION);
+		} else if (has_option(argv[i], MAX_WALL_MS_OPTION)) {
+			max_wall_ms = parse_limit(argv[i], MAX_WALL_MS_OPTION);
+		} else if (!strcmp(argv[i], NO_FUSION_OPTION)) {
+			fusion = false;
+		} else if (!strcmp(argv[i], FUSION_STATS_OPTION)) {
+			fusion_stats = true;
+		} else if (has_option(argv[i], SWEEP_OPTION)) {
+			if (!parse_sweep(argv[i] + strlen(SWEEP_OPTION), &sweep)) {
+				fprintf(stderr,"Invalid sweep, expected rN:first:count");
+				exit(EXIT_FAILURE);
+			}
+			sweep_mode = true;
+		} else if (!strcmp(argv[i], TIMING_OPTION)) {
+			timing_mode = true;
+		} else if (has_option(argv[i], ICACHE_OPTION) || has_option(argv[i], DCACHE_OPTION)) {
+			bool icache = has_option(argv[i], ICACHE_OPTION);
+			Cache_Config *cache = icache ? &timing_config.icache : &timing_config.dcache;
+			if (!parse_cache(argv[i] + strlen(ICACHE_OPTION), cache)) {
+				fprintf(stderr,"Invalid cache, expected size:line:ways");
+				exit(EXIT_FAILURE);
+			}
+			timing_mode = true;
+		} else if (has_option(argv[i], PREDICTOR_OPTION)) {
+			timing_config.predictor_entries = parse_limit(argv[i], PREDICTOR_OPTION);
+			timing_mode = true;
+		} else if (!strcmp(argv[i], HOST_PERF_OPTION)) {
+			host_perf_mode = true;
+		} else if (has_option(argv[i], SERVE_OPTION)) {
+			serve_config.path = argv[i] + strlen(SERVE_OPTION);
+		} else if (has_option(argv[i], BATCH_OPTION)) {
+			batch_directory = argv[i] + strlen(BATCH_OPTION);
+		} else if (!strcmp(argv[i], NO_URING_OPTION)) {
+			no_uring = true;
+		} else if (has_option(argv[i], THREADS_OPTION)) {
+			serve_config.threads = parse_limit(argv[i], THREADS_OPTION);
+		} else if (has_option(argv[i], FUZZ_OPTION)) {
+			if (!parse_fuzz_region(argv[i] + strlen(FUZZ_OPTION), &fuzz_config)) {
+				fprintf(stderr,"Invalid fuzz input region, expected address:size");
+				exit(EXIT_FAILURE);
+			}
+			fuzz_mode = true;
+		} else if (has_option(argv[i], FUZZ_RUNS_OPTION)) {
+			fuzz_config.runs = parse_limit(argv[i], FUZZ_RUNS_OPTION);
+		} else if (has_option(argv[i], FUZZ_SEED_OPTION)) {
+			fuzz_config.seed = parse_limit(argv[i], FUZZ_SEED_OPTION);
+		} else if (has_option(argv[i], FUZZ_OUT_OPTION)) {
+			fuzz_config.out_dir = argv[i] + strlen(FUZZ_OUT_OPTION);
+		} else if (!strcmp(argv[i], REVERSE_OPTION)) {
+			reverse_mode = true;
+		} else if (has_option(argv[i], REVERSE_INTERVAL_OPTION)) {
+			reverse_config.interval = parse_limit(argv[i], REVERSE_INTERVAL_OPTION);
+		} else if (has_option(argv[i], REVERSE_BUDGET_OPTION)) {
+			reverse_config.budget = parse_limit(argv[i], REVERSE_BUDGET_OPTION) << 20;
+		} else if (has_option(argv[i], GDB_OPTION)) {
+			gdb_address = argv[i] + strlen(GDB_OPTION);
+		} else if (filename == NULL) {
+			filename = argv[i];
+		} else {
+			filename = NULL;
+			break;
+		}
+	}
 
-	if (argc != 2) {
+	if (serve_config.path != NULL) {
+		if (filename != NULL) {
+			fprintf(stderr,"--serve takes no file");
+			exit(EXIT_FAILURE);
+		}
+		serve_config.max_steps = max_steps;
+		serve_config.max_wall_ms = max_wall_ms;
+		return serve(&serve_config);
+	}
+
+	if (batch_directory != NULL) {
+		if (filename != NULL) {
+			fprintf(stderr,"--batch takes no file");
+			exit(EXIT_FAILURE);
+		}
+		return run_batch(batch_directory,format,max_steps,max_wall_ms,fusion,no_uring);
+	}
+
+	if (filename == NULL) {
 		fprintf(stderr,"Invalid argument number");
 		exit(EXIT_FAILURE);
 	}
 	else {
-		if((input = fopen(argv[1],"rb")) == NULL) {
+		if((input = fopen(filename,"rb")) == NULL) {
 			fprintf(stderr,"File could not be found");
 			exit(EXIT_FAILURE);
 		}
 	}
 
-	int n = strlen(argv[1]);
-	if(strncmp("stack",&argv[1][n - 7],5) == 0) {
-		stack_mode = true;
+	if (sweep_mode && max_wall_ms) {
+		fprintf(stderr,"--max-wall-ms is not supported with --sweep");
+		exit(EXIT_FAILURE);
+	}
+	if (sweep_mode && (timing_mode || host_perf_mode)) {
+		fprintf(stderr,"--timing and --host-perf are not supported with --sweep");
+		exit(EXIT_FAILURE);
 	}
 
-	// -- Declaration and initialization of memory and registers storage
-	// --
+	if (fuzz_mode && (sweep_mode || timing_mode || host_perf_mode)) {
+		fprintf(stderr,"--sweep, --timing and --host-perf are not supported with --fuzz");
+		exit(EXIT_FAILURE);
+	}
+	if (reverse_mode && (sweep_mode || timing_mode || host_perf_mode || fuzz_mode)) {
+		fprintf(stderr,"--sweep, --timing, --host-perf and --fuzz are not supported with --reverse");
+		exit(EXIT_FAILURE);
+	}
+	if (gdb_address != NULL && (sweep_mode || timing_mode || host_perf_mode || fuzz_mode || reverse_mode)) {
+		fprintf(stderr,"--sweep, --timing, --host-perf, --fuzz and --reverse are not supported with --gdb");
+		exit(EXIT_FAILURE);
+	}
 
-	Machine arm;
+	stack_mode = is_stack_file(filename);
 
-	memset(arm.memory, 0, MEMORY_SIZE * sizeof(uint8_t));
-	memset(arm.general_reg, 0, GENERAL_REGISTERS_NUM * sizeof(uint32_t));
+	// -- Declaration and initialization of memory and registers storage
+	// --
 
-	arm.cpsr_reg = 0;
-	arm.pc_reg = 0;
-	arm.end = false;
-	arm.branch_executed = false;
-	arm.shifter_carry = 0;
+	Machine *arm = armemu_create();
+	if (arm == NULL) {
+		fprintf(stderr,"Could not allocate the machine");
+		exit(EXIT_FAILURE);
+	}
 
 	// -- Store input onto memory
-	// -- byte-by-byte and then divide count by 4
-
-	int instr_count = 0;
-	arm.general_reg[SP_REG] = MEMORY_SIZE;
 
-	// Functions pointer array
+	uint8_t *image = malloc(MEMORY_SIZE);
+	size_t image_size = fread(image,1,MEMORY_SIZE,input);
+	fclose(input);
 
-	ProcFunc data_proc_func[14];
-	init_data_proc_func(data_proc_func);
-
-	while(!feof(input)) {
-		if(instr_count == MEMORY_SIZE) {
-			fprintf(stderr,"Instructions exceeded memory size");
+	if (sweep_mode) {
+		uint32_t magic = 0;
+		memcpy(&magic,image,image_size < sizeof(magic) ? image_size : sizeof(magic));
+		if (magic == ARMEMU_IMAGE_MAGIC) {
+			fprintf(stderr,"--sweep is not supported with sectioned images");
 			exit(EXIT_FAILURE);
 		}
-		fread(&arm.memory[instr_count],1,1,input);
-		++instr_count;
+		int status = run_sweep(image,image_size,&sweep,format,stack_mode,max_steps);
+		free(image);
+		armemu_destroy(arm);
+		return status;
 	}
 
-	instr_count = ceil(instr_count / 4);
+	if(!armemu_load(arm,image,image_size)) {
+		fprintf(stderr,"%s",load_error(arm));
+		exit(EXIT_FAILURE);
+	}
+	free(image);
 
-	arm.stack_limit = instr_count * 4 + 1;
+	if (fuzz_mode) {
+		fuzz_config.max_steps = max_steps ? max_steps : FUZZ_DEFAULT_STEPS;
+		return run_fuzz(arm,&fuzz_config);
+	}
+	if (reverse_mode) {
+		armemu_set_fusion(arm,fusion);
+		return run_reverse(arm,&reverse_config);
+	}
+	if (gdb_address != NULL) {
+		return run_gdb(arm,gdb_address,fusion);
+	}
 
-	// -- Start the pipeline
-	// -- initialise all 3 stages to NULL
+	arm->report_errors = format == OUTPUT_TEXT;
+	armemu_set_fusion(arm,fusion);
 
-	Instr fetched_instr;
-	fetched_instr.exists = false;
-	fetched_instr.bits = 0;
-	Decoded_Instr decoded_instr;
+	// GPIO events go before the text state, or to stderr next to a dump
 
-	while(!arm.end) {
-		if(decoded_instr.exists) {
-			execute(&decoded_instr,&arm,data_proc_func); // <- execute previously decoded instruction
-			//		print_machine_status(&arm,stack_mode);
-			//		print_instr(&decoded_instr);
-			//printf("\n\n\n");
-			if(arm.end) {
-				break; // <- exit loop if halt instruction was executed
-			}
-			if(arm.branch_executed) {
-				decoded_instr.exists = false;
-				fetched_instr.exists = false; // <- if branch instruction was executed
-				arm.branch_executed = false;  // <- clear the pipeline and the checker
-			}
-		}
+	Gpio gpio;
+	gpio_attach(&gpio,arm,format == OUTPUT_TEXT ? stdout : stderr);
 
-		if(fetched_instr.exists) {
-			decode(&decoded_instr,&fetched_instr,&arm); // <- decode previously fetched instruction
+	Timing *timing = NULL;
+	if (timing_mode) {
+		timing = timing_create(&timing_config);
+		if (timing == NULL) {
+			fprintf(stderr,"Invalid cache or predictor configuration");
+			exit(EXIT_FAILURE);
 		}
-
-		if(abs(arm.pc_reg-PIPELINE_OFFSET) >= MEMORY_SIZE) {
-			perror("PC exceeded memory size");
+		if (!timing_attach(timing,arm)) {
+			fprintf(stderr,"Timing model not built in, rebuild with make TIMING=1");
 			exit(EXIT_FAILURE);
 		}
-		memcpy(&fetched_instr.bits,&arm.memory[arm.pc_reg],4); // fetch from memory acc to PC
-		fetched_instr.exists = true;
+	}
 
-		if(fetched_instr.exists && fetched_instr.bits) {
-			//		print_bits(fetched_instr.bits);
+	Host_Perf *host_perf = NULL;
+	if (host_perf_mode) {
+		host_perf = host_perf_create();
+		if (host_perf == NULL) {
+			fprintf(stderr,"Could not allocate the host profile");
+			exit(EXIT_FAILURE);
 		}
-		arm.pc_reg += 4;
+		if (!host_perf_start(host_perf,arm)) {
+			fprintf(stderr,"Host profiling not built in, rebuild with make HOST_PERF=1");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// -- Run the pipeline until halt
+
+	if (max_steps || max_wall_ms) {
+		armemu_run_limited(arm,max_steps,max_wall_ms);
+	} else {
+		armemu_run(arm);
+	}
+
+	if (host_perf != NULL) {
+		host_perf_stop(host_perf);
+	}
+	gpio_flush(&gpio);
+	if (fusion_stats) {
+		print_fusion_stats(arm,stderr);
+	}
+	if (timing != NULL) {
+		print_timing_report(timing,stderr);
+		timing_destroy(timing);
+	}
+	if (host_perf != NULL) {
+		print_host_perf_report(host_perf,stderr);
+		host_perf_destroy(host_perf);
+	}
+
+	switch(arm->fault) {
+	case ARMEMU_PC_OUT_OF_RANGE:
+		fprintf(stderr,"PC exceeded memory size");
+		exit(EXIT_FAILURE);
+	case ARMEMU_STACK_LIMIT:
+		fprintf(stderr, "Error: Illegal memory access: stack limit exceeded");
+		exit(EXIT_FAILURE);
+	default:
+		break;
 	}
 
 	// -- Print the final machine state
 	// --
 
-	print_machine_status(&arm,stack_mode);
+	switch(format) {
+	case OUTPUT_JSON:
+		dump_json(arm,stdout);
+		break;
+	case OUTPUT_BINARY:
+		dump_binary(arm,stdout);
+		break;
+	default:
+		print_machine_status(arm,stack_mode);
+	}
+
+	switch(arm->fault) {
+	case ARMEMU_STEP_LIMIT:
+		fprintf(stderr,"Step limit reached");
+		exit(EXIT_STEP_LIMIT);
+	case ARMEMU_TIME_LIMIT:
+		fprintf(stderr,"Time limit reached");
+		exit(EXIT_TIME_LIMIT);
+	case ARMEMU_SPIN:
+		if (arm->end) {
+			fprintf(stderr,"Stopped spinning at 0x%08x",arm->fault_addr);
+		}
+		break;
+	default:
+		break;
+	}
 
+	armemu_destroy(arm);
 	return EXIT_SUCCESS;
 }
@@ -1,16 +1,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "emulator_processor.h"
-#include "emulator_processor.h"
 #include "decode_helpers.h"
+#include "shifter.h"
+#include "semihost.h"
+#include "timing.h"
+#include "host_perf.h"
+#include "fuzz.h"
+#include "reverse.h"
 #include <string.h>
 
-#define N_MASK 1 << 31
-#define Z_MASK 1 << 30
-#define C_MASK 1 << 29
-#define V_MASK 1 << 28
-
 #define DATA_PROC_FLAG_MASK 0xe // 1110
+#define ARITH_FLAG_MASK 0xf // 1111
 #define MUL_FLAG_MASK 0xc // 1100
 
 // --
@@ -23,10 +24,8 @@ void data_process(Decoded_Instr *instr, Machine *arm, ProcFunc data_proc_func[14
 	uint32_t op1 = arm->general_reg[instr->rn];
 	uint8_t code = instr->opcode;
 	ProcFunc func = data_proc_func[code];
-	uint32_t op2 = decode_offset(instr->op2, instr->imm, arm);
+	uint32_t op2 = decode_operand2(instr, arm);
 	uint32_t res = func(op1, op2, instr->set, arm);
-	instr->offset = instr->op2;
-	instr->op2 = op2;
 	if (code != 8 && code != 9 && code != 10) {
 		arm->general_reg[instr->rd] = res;
 	}
@@ -64,7 +63,8 @@ uint32_t func_sub(uint32_t op1, uint32_t op2, bool flags, Machine *arm) {
 		uint8_t N = (res & N_MASK) ? 1 : 0;
 		uint8_t Z = (res) ? 0 : 1;
 		uint8_t C = op1 >= op2;
-		set_flags(arm, N, Z, C, 0, DATA_PROC_FLAG_MASK);
+		uint8_t V = ((op1 ^ op2) & (op1 ^ res)) >> 31;
+		set_flags(arm, N, Z, C, V, ARITH_FLAG_MASK);
 	}
 	return res;
 }
@@ -75,7 +75,8 @@ uint32_t func_rsb(uint32_t op1, uint32_t op2, bool flags, Machine *arm) {
 		uint8_t N = (res & N_MASK) ? 1 : 0;
 		uint8_t Z = (res) ? 0 : 1;
 		uint8_t C = op2 >= op1;
-		set_flags(arm, N, Z, C, 0, DATA_PROC_FLAG_MASK);
+		uint8_t V = ((op2 ^ op1) & (op2 ^ res)) >> 31;
+		set_flags(arm, N, Z, C, V, ARITH_FLAG_MASK);
 	}
 	return res;
 
@@ -87,7 +88,8 @@ uint32_t func_add(uint32_t op1, uint32_t op2, bool flags, Machine *arm) {
 		uint8_t N = (res & N_MASK) ? 1 : 0;
 		uint8_t Z = (res) ? 0 : 1;
 		uint8_t C = (res < op1);
-		set_flags(arm, N, Z, C, 0, DATA_PROC_FLAG_MASK);
+		uint8_t V = (~(op1 ^ op2) & (op1 ^ res)) >> 31;
+		set_flags(arm, N, Z, C, V, ARITH_FLAG_MASK);
 	}
 	return res;
 }
@@ -120,7 +122,8 @@ uint32_t func_cmp(uint32_t op1, uint32_t op2, bool flags, Machine *arm) {
 		uint8_t N = (res & N_MASK) ? 1 : 0;
 		uint8_t Z = (res) ? 0 : 1;
 		uint8_t C = op1 >= op2;
-		set_flags(arm, N, Z, C, 0, DATA_PROC_FLAG_MASK);
+		uint8_t V = ((op1 ^ op2) & (op1 ^ res)) >> 31;
+		set_flags(arm, N, Z, C, V, ARITH_FLAG_MASK);
 	}
 	return 0;
 }
@@ -166,68 +169,26 @@ void init_data_proc_func(ProcFunc func_array[14]) {
 
 void multiply(Decoded_Instr *instr, Machine *arm) {
 	uint32_t result;
-	uint32_t rs = arm->general_reg[instr->rs];
-	uint32_t rm = arm->general_reg[instr->rm];
+	uint32_t rs = arm->general_reg[instr->operand.mul.rs];
+	uint32_t rm = arm->general_reg[instr->operand.mul.rm];
 	result = rm * rs;
 	if (instr->accum) {
 		result += arm->general_reg[instr->rn];
 	}
 	arm->general_reg[instr->rd] = result;
+	if (instr->set) {
+		uint8_t N = (result & N_MASK) ? 1 : 0;
+		uint8_t Z = (result) ? 0 : 1;
+		set_flags(arm, N, Z, 0, 0, MUL_FLAG_MASK);
+	}
 }
 
-//Barrel shifter
-
-uint32_t barrel_shift(uint32_t to_shift, uint8_t ammount, uint8_t type, Machine *arm) {
-	uint8_t *carry = &(arm->shifter_carry);
-	if (ammount == 0) {
-		*carry = 0;
-		return to_shift;
-	}
-	switch (type) {
-	case 0:         // logical left
-		if (ammount >= 32) {
-			*carry = 0;
-			return 0;
-		} else {
-			*carry = (0x1 << (32 - ammount)) & to_shift;
-			return to_shift << ammount;
-		}
-	case 1:         //logical right
-		if (ammount >= 32) {
-			*carry = 0;
-			return 0;
-		} else {
-			*carry = (0x1 << (ammount - 1)) & to_shift;
-			return to_shift >> ammount;
-		}
-	case 2:         // arithmetic right
-		if (ammount >= 32) {
-			if (to_shift >> 31) {
-				return 0xffffffff;
-				*carry = -1;
-			} else {
-				return 0;
-				*carry = 0;
-			}
-		} else {
-			*carry = (0x1 << (ammount - 1)) & to_shift;
-			if (to_shift >> 31) {
-				uint32_t bottom = to_shift >> ammount;
-				uint32_t top = 0xffffffff << (32 - ammount);
-				return top | bottom;
-			} else {
-				return to_shift >> ammount;
-			}
-		}
-	case 3:         // rotate right
-		ammount = ammount % 32;
-		*carry = (0x1 << (ammount - 1)) & to_shift;
-		uint32_t bottom = to_shift >> ammount;
-		uint8_t offset = 32 - ammount;
-		uint32_t top = (to_shift << offset);
-		return top | bottom;
-	default:
-		return 0;
+void out_of_bounds(Machine *arm, uint32_t address) {
+	arm->fault = ARMEMU_OUT_OF_BOUNDS;
+	arm->fault_addr = address;
+	FUZZ_CRASH(arm);
+	if (arm->report_errors) {
+		printf("Error: Out of bounds memory access at address 0x%08x\n", address);
 	}
 }
 
@@ -236,9 +197,9 @@ uint32_t barrel_shift(uint32_t to_shift, uint8_t ammount, uint8_t type, Machine
 void data_transfer(Decoded_Instr *instr, Machine *arm) {
 	uint32_t offset;
 	if (!instr->imm) {   // opposed to data instr imm
-		offset = instr->offset;
+		offset = instr->operand.offset;
 	} else {
-		offset = decode_offset(instr->offset, 0, arm);
+		offset = decode_offset(instr->operand.offset, arm);
 	}
 	if (!instr->up) {
 		offset = -offset;
@@ -257,106 +218,147 @@ void data_transfer(Decoded_Instr *instr, Machine *arm) {
 		arm->general_reg[instr->rn] += offset;
 	}
 
-	if (rn + 4 >= MEMORY_SIZE) {
-		printf("Error: Out of bounds memory access at address 0x%08x\n", rn);
+	if (rn > MEMORY_SIZE - sizeof(uint32_t)) {
+		if (mmio_transfer(arm, rn, instr->load, &arm->general_reg[instr->rd])) {
+			return;
+		}
+		out_of_bounds(arm, rn);
 		return;
 	}
 
 	// assuming a valid adress in memory is provided
+	TIMING_DATA(arm, rn, sizeof(uint32_t));
 	if (instr->load) {
 		memcpy(&arm->general_reg[instr->rd], &arm->memory[rn], sizeof(uint32_t));
 	} else {
 		memcpy(&arm->memory[rn], &arm->general_reg[instr->rd], sizeof(uint32_t));
+		invalidate_stored(arm, rn, sizeof(uint32_t));
 	}
 
 	// TODO: check if RN is PC register !!!
 }
+
+// Memory-mapped I/O, only reached once an address is outside guest memory
+// so ordinary loads and stores keep their single bounds check
+
+bool mmio_transfer(Machine *arm, uint32_t address, bool load, uint32_t *reg) {
+	for (int i = 0; i < arm->mmio_count; i++) {
+		Mmio_Region *region = &arm->mmio[i];
+		if (address - region->start < region->size) {
+			if (load) {
+				*reg = region->read ? region->read(region->device, address - region->start) : 0;
+			} else if (region->write) {
+				region->write(region->device, address - region->start, *reg);
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
 // -- Branch Instruction
 
 void branch(Decoded_Instr *instr, Machine *arm) {
-	int32_t val = (instr->sgn_offset) << 8;
-	val >>= 8;
-	val <<= 2;
-	arm->pc_reg += val;
+	TIMING_BRANCH(arm, true);
+	arm->pc_reg += instr->operand.sgn_offset;
 	arm->branch_executed = true;
+	FUZZ_EDGE(arm, arm->pc_reg);
 }
 
-void multi_transfer(Decoded_Instr *instr,Machine *arm) {
-	uint32_t address = arm->general_reg[instr->rn];
-	uint16_t reg_list = instr->register_list;
-	uint16_t cp_list = reg_list;
-	uint8_t num = 0;
-	while(cp_list) {
-		if(cp_list & 1) {
-			num++;
+// Registers go to consecutive words in ascending order, so a list without
+// gaps moves in one copy and any other only visits its set bits. Going up
+// the pre-indexed words are the ones after the base, going down the ones
+// up to it. r15 is the PC: stored 8 bytes ahead, and loading it branches.
+
+static void load_registers(Machine *arm, uint32_t list, uint32_t address) {
+	for (; list; list &= list - 1, address += 4) {
+		uint32_t reg = __builtin_ctz(list);
+		if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+			out_of_bounds(arm, address);
+			continue;
+		}
+		TIMING_DATA(arm, address, sizeof(uint32_t));
+		if (reg == PC_REG) {
+			memcpy(&arm->pc_reg, &arm->memory[address], sizeof(uint32_t));
+			arm->branch_executed = true;
+			FUZZ_EDGE(arm, arm->pc_reg);
+		} else {
+			memcpy(&arm->general_reg[reg], &arm->memory[address], sizeof(uint32_t));
 		}
-		cp_list >>= 1;
 	}
-	int top = 0;
-	int bottom = 0;
-
-	if(instr->write_back) {
-		if(!instr->up) {
-			top = address;
-			bottom = address - 4 * num;
-			arm->general_reg[instr->rn] = bottom;
+}
 
+static void store_registers(Machine *arm, uint32_t list, uint32_t address) {
+	for (; list; list &= list - 1, address += 4) {
+		uint32_t reg = __builtin_ctz(list);
+		if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+			out_of_bounds(arm, address);
+			continue;
 		}
-		else {
-			top = address + 4 * num;
-			bottom = address;
-			arm->general_reg[instr->rn] = top;
-		}
+		TIMING_DATA(arm, address, sizeof(uint32_t));
+		uint32_t *value = reg == PC_REG ? &arm->pc_reg : &arm->general_reg[reg];
+		memcpy(&arm->memory[address], value, sizeof(uint32_t));
+		invalidate_stored(arm, address, sizeof(uint32_t));
 	}
+}
 
-	if(!instr->up) {
-		address = address - 4 * num;
-	}
+void multi_transfer(Decoded_Instr *instr,Machine *arm) {
+	uint32_t list = instr->operand.register_list;
+	uint32_t size = 4 * __builtin_popcount(list);
+	uint32_t base = arm->general_reg[instr->rn];
+	uint32_t bottom = instr->up ? base : base - size;
+	uint32_t top = bottom + size;
 
-	if(top > MEMORY_SIZE || bottom <= arm->stack_limit) {
-		fprintf(stderr, "Error: Illegal memory access: stack limit exceeded");
-		exit(EXIT_FAILURE);
+	if(instr->write_back) {
+		arm->general_reg[instr->rn] = instr->up ? top : bottom;
+		if(top > MEMORY_SIZE || bottom <= arm->stack_limit) {
+			arm->fault = ARMEMU_STACK_LIMIT;
+			arm->fault_addr = bottom;
+			arm->end = true;
+			return;
+		}
 	}
-
-	num = 0;
-
-	if(instr->up) {
-		instr->pre_index = !instr->pre_index;
+	if (!list) {
+		return;
 	}
 
-	while(reg_list) {
-		if(reg_list & 1) {
-			if(instr->load) {
-				if(instr->pre_index) {
-					address+=4;
-					memcpy(&arm->general_reg[num], &arm->memory[address], sizeof(uint32_t));
-				} else {
-					memcpy(&arm->general_reg[num], &arm->memory[address], sizeof(uint32_t));
-					address+=4;
-				}
-			}
-			else {
-				if(instr->pre_index) {
-					address+=4;
-					memcpy(&arm->memory[address], &arm->general_reg[num], sizeof(uint32_t));
-				} else {
-					memcpy(&arm->memory[address], &arm->general_reg[num], sizeof(uint32_t));
-					address+=4;
-				}
-			}
+	// instructions are cached decoded, so the flipped bit is kept locally
+	bool pre_index = instr->up ? !instr->pre_index : instr->pre_index;
+	uint32_t address = pre_index ? bottom + 4 : bottom;
+	uint32_t low = __builtin_ctz(list);
+	bool dense = ((list >> low) & ((list >> low) + 1)) == 0;
+	bool fits = size <= MEMORY_SIZE && address <= MEMORY_SIZE - size;
+
+	if (dense && fits && !(list & (1 << PC_REG))) {
+		TIMING_DATA(arm, address, size);
+		if (instr->load) {
+			memcpy(&arm->general_reg[low], &arm->memory[address], size);
+		} else {
+			memcpy(&arm->memory[address], &arm->general_reg[low], size);
+			invalidate_stored(arm, address, size);
 		}
-		reg_list >>=1;
-		num++;
+	} else if (instr->load) {
+		load_registers(arm, list, address);
+	} else {
+		store_registers(arm, list, address);
 	}
 }
 
 void execute(Decoded_Instr *instr, Machine *arm, ProcFunc data_proc_func[14]) {
 	if (instr->type == HALT) {
+		if (instr->set) {
+			arm->fault = ARMEMU_BREAKPOINT;
+			arm->fault_addr = arm->pc_reg - PIPELINE_OFFSET;
+		}
 		arm->end = true;
 		return;
 	}
 
-	if (!check_condition(arm, instr)) {
+	if (instr->conditional && !check_condition(arm, instr)) {
+		if (instr->type == BRANCH) {
+			TIMING_BRANCH(arm, false);
+			FUZZ_EDGE(arm, arm->pc_reg - PIPELINE_OFFSET + 4);
+		}
 		return;
 	}
 
@@ -376,6 +378,9 @@ void execute(Decoded_Instr *instr, Machine *arm, ProcFunc data_proc_func[14]) {
 	case MULTI_TRANSFER:
 		multi_transfer(instr,arm);
 		return;
+	case SEMIHOST:
+		semihost(instr, arm);
+		return;
 	case NOOP:
 		return;
 	default:
@@ -393,6 +398,7 @@ void decode(Decoded_Instr *decoded, Instr *instr, Machine *arm) {
 	decoded->type = get_instr_type(instr);
 	decoded->exists = true;
 	decoded->cond = get_cond(instr);
+	decoded->conditional = decoded->cond != al;
 
 	if (decoded->type == DATA_PROC) {
 		decoded->imm = is_immediate(instr);
@@ -400,14 +406,18 @@ void decode(Decoded_Instr *decoded, Instr *instr, Machine *arm) {
 		decoded->set = is_set(instr);
 		decoded->rn = get_rn(instr);
 		decoded->rd = get_rd(instr);
-		decoded->op2 = get_operand2(instr);
+		decoded->operand.op2 = get_operand2(instr);
+		if (decoded->imm) {
+			decoded->accum = immediate_rotated(decoded->operand.op2);
+			decoded->operand.op2 = rotate_immediate(decoded->operand.op2);
+		}
 	} else if (decoded->type == MUL) {
 		decoded->accum = to_accumulate(instr);
 		decoded->set = is_set(instr);
 		decoded->rd = get_rd_MUL(instr);
 		decoded->rn = get_rn_MUL(instr);
-		decoded->rs = get_rs_MUL(instr);
-		decoded->rm = get_rm_MUL(instr);
+		decoded->operand.mul.rs = get_rs_MUL(instr);
+		decoded->operand.mul.rm = get_rm_MUL(instr);
 	} else if (decoded->type == TRANSFER) {
 		decoded->imm = is_immediate(instr);
 		decoded->pre_index = is_pre_index(instr);
@@ -416,50 +426,143 @@ void decode(Decoded_Instr *decoded, Instr *instr, Machine *arm) {
 		decoded->load = is_load(instr);
 		decoded->rn = get_rn(instr);
 		decoded->rd = get_rd(instr);
-		decoded->offset = get_offset_TRANSFER(instr);
+		decoded->operand.offset = get_offset_TRANSFER(instr);
 	} else if (decoded->type == MULTI_TRANSFER) {
 		decoded->pre_index = is_pre_index(instr);
 		decoded->up = is_up(instr);
 		decoded->write_back = is_write_back(instr);
 		decoded->load = is_load(instr);
 		decoded->rn = get_rn(instr);
-		decoded->register_list = get_register_list(instr);
+		decoded->operand.register_list = get_register_list(instr);
+	} else if (decoded->type == SEMIHOST) {
+		decoded->operand.call = get_comment_SWI(instr);
 	}
 	else {
-		decoded->sgn_offset = get_offset_BRANCH(instr);
+		decoded->set = false;   // <- a halt, not a breakpoint
+		int32_t val = get_offset_BRANCH(instr) << 8;   // sign extend the 24 bit word offset
+		decoded->operand.sgn_offset = (val >> 8) * 4;
+	}
+}
+
+Decoded_Instr *predecode(Machine *arm, uint32_t address) {
+	Decoded_Instr *decoded = &arm->predecoded[address / 4];
+	if (!decoded->exists) {
+		Instr instr;
+		instr.exists = true;
+		memcpy(&instr.bits, &arm->memory[address], sizeof(uint32_t));
+		HOST_STAGE(arm, STAGE_DECODE);
+		decode(decoded, &instr, arm);
+		HOST_STAGE(arm, STAGE_FETCH);
+		decoded->fusion = NO_FUSION;
+		decoded->fusion_checked = false;
+	}
+	return decoded;
+}
+
+// A breakpoint is a halt with 'set', which nothing fuses with
+
+void tag_breakpoint(Machine *arm, uint32_t address) {
+	drop_decoded(arm, address);
+	Decoded_Instr *decoded = &arm->predecoded[address / 4];
+	decoded->type = HALT;
+	decoded->exists = true;
+	decoded->set = true;
+	decoded->conditional = false;
+	decoded->fusion = NO_FUSION;
+	decoded->fusion_checked = true;
+}
+
+void invalidate_stored(Machine *arm, uint32_t address, uint32_t length) {
+	if (length == 0 || address >= MEMORY_SIZE) {
+		return;
+	}
+	uint32_t last = address + length - 1;
+	for (uint32_t word = address / 4; word <= last / 4; word++) {
+		FUZZ_DIRTY(arm, word * 4);
+		REVERSE_DIRTY(arm, word * 4);
+		drop_decoded(arm, word * 4);
+	}
+	uint64_t pages = (2ull << (last >> TRAP_PAGE_SHIFT)) - (1ull << (address >> TRAP_PAGE_SHIFT));
+	if (arm->trapped_pages & pages) {
+		trapped_store(arm, address, length);
+	}
+}
+
+void drop_decoded(Machine *arm, uint32_t address) {
+	uint32_t word = address / 4;
+	arm->predecoded[word].exists = false;
+	for (uint32_t i = 1; i < FUSION_MAX_LENGTH && i <= word; i++) {
+		arm->predecoded[word - i].fusion = NO_FUSION;
+		arm->predecoded[word - i].fusion_checked = false;
 	}
 }
 
-// extra functions - for Data Processing execution:
+void write_memory(Machine *arm, uint32_t address, const uint8_t *data, uint32_t length) {
+	if (!memcmp(&arm->memory[address], data, length)) {
+		return;
+	}
+	for (uint32_t i = 0; i < length; i += sizeof(uint32_t)) {
+		if (memcmp(&arm->memory[address + i], &data[i], sizeof(uint32_t))) {
+			memcpy(&arm->memory[address + i], &data[i], sizeof(uint32_t));
+			armemu_invalidate(arm, address + i, sizeof(uint32_t));
+		}
+	}
+}
+
+// -- Condition table
+// -- bit 'nzcv' of row 'cond' is set if the condition holds for CPSR flags nzcv
+
+#define FLAG_N(f) (((f) >> 3) & 1)
+#define FLAG_Z(f) (((f) >> 2) & 1)
+#define FLAG_C(f) (((f) >> 1) & 1)
+#define FLAG_V(f) ((f) & 1)
+
+#define COND_EQ(f) FLAG_Z(f)
+#define COND_NE(f) !FLAG_Z(f)
+#define COND_CS(f) FLAG_C(f)
+#define COND_CC(f) !FLAG_C(f)
+#define COND_MI(f) FLAG_N(f)
+#define COND_PL(f) !FLAG_N(f)
+#define COND_VS(f) FLAG_V(f)
+#define COND_VC(f) !FLAG_V(f)
+#define COND_HI(f) (FLAG_C(f) && !FLAG_Z(f))
+#define COND_LS(f) (!FLAG_C(f) || FLAG_Z(f))
+#define COND_GE(f) (FLAG_N(f) == FLAG_V(f))
+#define COND_LT(f) (FLAG_N(f) != FLAG_V(f))
+#define COND_GT(f) (!FLAG_Z(f) && FLAG_N(f) == FLAG_V(f))
+#define COND_LE(f) (FLAG_Z(f) || FLAG_N(f) != FLAG_V(f))
+#define COND_AL(f) 1
+#define COND_NV(f) 0
+
+#define COND_BIT(c, f) ((c(f) ? 1 : 0) << (f))
+#define COND_ROW(c) \
+	(COND_BIT(c, 0) | COND_BIT(c, 1) | COND_BIT(c, 2) | COND_BIT(c, 3) \
+	 | COND_BIT(c, 4) | COND_BIT(c, 5) | COND_BIT(c, 6) | COND_BIT(c, 7) \
+	 | COND_BIT(c, 8) | COND_BIT(c, 9) | COND_BIT(c, 10) | COND_BIT(c, 11) \
+	 | COND_BIT(c, 12) | COND_BIT(c, 13) | COND_BIT(c, 14) | COND_BIT(c, 15))
+
+const uint16_t cond_table[16] = {
+	[eq] = COND_ROW(COND_EQ),
+	[ne] = COND_ROW(COND_NE),
+	[cs] = COND_ROW(COND_CS),
+	[cc] = COND_ROW(COND_CC),
+	[mi] = COND_ROW(COND_MI),
+	[pl] = COND_ROW(COND_PL),
+	[vs] = COND_ROW(COND_VS),
+	[vc] = COND_ROW(COND_VC),
+	[hi] = COND_ROW(COND_HI),
+	[ls] = COND_ROW(COND_LS),
+	[ge] = COND_ROW(COND_GE),
+	[lt] = COND_ROW(COND_LT),
+	[gt] = COND_ROW(COND_GT),
+	[le] = COND_ROW(COND_LE),
+	[al] = COND_ROW(COND_AL),
+	[nv] = COND_ROW(COND_NV)
+};
+
 // Check if the cond field is satisfied by the CPSR register
 bool check_condition(Machine *arm, Decoded_Instr *instruction) {
-	uint32_t cond = instruction->cond;
-	uint32_t cpsr = arm->cpsr_reg;
-	uint32_t get_N = N_MASK & cpsr;
-	uint32_t get_Z = Z_MASK & cpsr;
-//	uint32_t get_C = C_MASK & cpsr;
-	uint32_t get_V = V_MASK & cpsr;
-
-//	printf("CONDITION: %x NZCV:%x %x %x %x",cond,get_N,get_Z,get_C,get_V);
-
-	switch (cond) {
-	case eq:
-		return get_Z;
-	case ne:
-		return !get_Z;
-	case ge:
-		return (get_N == get_V);
-	case lt:
-		return !(get_N == get_V);
-	case gt:
-		return !get_Z && (get_N == get_V);
-	case le:
-		return get_Z || !(get_N == get_V);
-	case al:
-		return true;
-	default:
-		return false;
-	}
+	return (cond_table[instruction->cond] >> (arm->cpsr_reg >> 28)) & 1;
 }
 
 // set CPSR flags
@@ -5,23 +5,75 @@
 #include <stdbool.h>
 #include "define_structures.h"
 
+// CPSR flags
+
+#define N_MASK (1u << 31)
+#define Z_MASK (1u << 30)
+#define C_MASK (1u << 29)
+#define V_MASK (1u << 28)
+
 // Execute the decoded instruction 'instr'
 
 void execute(Decoded_Instr *instr, Machine *arm,ProcFunc data_proc_func[14]);
 
-// Data processing functions
+// Single instruction types, as dispatched by execute()
 
-void init_data_proc_func(ProcFunc func[14]);
+void data_process(Decoded_Instr *instr, Machine *arm, ProcFunc data_proc_func[14]);
+
+void data_transfer(Decoded_Instr *instr, Machine *arm);
+
+// Load/store a word through the device mapped at 'address', if any
+
+bool mmio_transfer(Machine *arm, uint32_t address, bool load, uint32_t *reg);
 
-// Barrel shifter
-// shift by 'amount' times and stores the last carry bit in carry
+// Record a skipped access outside guest memory, printing it if errors are reported
 
-uint32_t barrel_shift(uint32_t to_shift,uint8_t ammount,uint8_t type,Machine *arm);
+void out_of_bounds(Machine *arm, uint32_t address);
+
+// Data processing functions
+
+void init_data_proc_func(ProcFunc func[14]);
 
 // Decode the fetched 'instr' and store it in 'decoded'
 
 void decode(Decoded_Instr *decoded, Instr *instr, Machine *arm);
 
+// Decoded instruction at 'address', decoded on first use
+
+Decoded_Instr *predecode(Machine *arm, uint32_t address);
+
+// Drop the decoded instructions of the words a guest store of 'length'
+// bytes at 'address' wrote and the fused groups running into them, mark
+// their pages dirty, and stop the run if a watchpoint covers any byte
+// written. A breakpoint stored over is kept.
+
+void invalidate_stored(Machine *arm, uint32_t address, uint32_t length);
+
+// The same for a write that is not a guest store: no watchpoint or dirty
+// page sees it. 'address' must be inside guest memory.
+
+void drop_decoded(Machine *arm, uint32_t address);
+
+// Make the instruction at 'address' stop runs as a breakpoint, until a
+// drop_decoded() there
+
+void tag_breakpoint(Machine *arm, uint32_t address);
+
+// invalidate_stored() for a store reaching a page with a breakpoint or
+// watchpoint, kept with their tables in armemu.c
+
+void trapped_store(Machine *arm, uint32_t address, uint32_t length);
+
+// Write 'length' bytes, a multiple of 4, at the word aligned 'address',
+// dropping the decoded instructions of only the words that change. A
+// restore from the host: no watchpoint or dirty page sees it.
+
+void write_memory(Machine *arm, uint32_t address, const uint8_t *data, uint32_t length);
+
+// Bit 'nzcv' of row 'cond' is set if the condition holds for CPSR flags nzcv
+
+extern const uint16_t cond_table[16];
+
 //check if the Cond field is satisfied by the CPSR register
 bool check_condition(Machine *arm, Decoded_Instr *instruction);
 
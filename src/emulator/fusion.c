@@ -0,0 +1,298 @@
+#include <stdint.h>
+
+#include "fusion.h"
+#include "emulator_processor.h"
+#include "decode_helpers.h"
+
+#define NZCV_MASK (N_MASK | Z_MASK | C_MASK | V_MASK)
+
+struct Fusion {
+	const char *name;
+	uint8_t length;
+	bool (*match)(Decoded_Instr *group);
+	uint64_t (*run)(Machine *arm, Decoded_Instr *group, uint64_t budget);
+};
+typedef struct Fusion Fusion;
+
+// --
+// -- Matchers, 'group' points at consecutive predecoded instructions
+// --
+
+static bool is_plain(Decoded_Instr *instr, enum type type) {
+	return instr->type == type && !instr->conditional;
+}
+
+static bool is_data_proc(Decoded_Instr *instr, uint8_t opcode) {
+	return is_plain(instr, DATA_PROC) && instr->opcode == opcode;
+}
+
+// sub rX,rX,#n
+static bool is_decrement(Decoded_Instr *instr) {
+	return is_data_proc(instr, OPCODE_SUB) && instr->imm && instr->rd == instr->rn;
+}
+
+// cmp only writes the flags with the S bit set
+static bool is_compare(Decoded_Instr *instr) {
+	return is_data_proc(instr, OPCODE_CMP) && instr->set;
+}
+
+static bool match_sub_cmp_branch(Decoded_Instr *group) {
+	return is_decrement(&group[0]) && is_compare(&group[1])
+	       && group[1].rn == group[0].rd && group[2].type == BRANCH;
+}
+
+static bool match_cmp_branch(Decoded_Instr *group) {
+	return is_compare(&group[0]) && group[1].type == BRANCH;
+}
+
+static bool match_sub_branch(Decoded_Instr *group) {
+	return is_decrement(&group[0]) && group[1].type == BRANCH;
+}
+
+static bool match_ldr_add(Decoded_Instr *group) {
+	return is_plain(&group[0], TRANSFER) && group[0].load && is_data_proc(&group[1], OPCODE_ADD);
+}
+
+static bool match_spin(Decoded_Instr *group) {
+	return group[0].type == BRANCH && group[0].operand.sgn_offset == -PIPELINE_OFFSET;
+}
+
+// Conditional branch closing a loop of 'length' instructions
+static bool is_loop_back(Decoded_Instr *instr, uint8_t length) {
+	return instr->type == BRANCH && instr->conditional
+	       && instr->operand.sgn_offset == -PIPELINE_OFFSET - 4 * (length - 1);
+}
+
+static bool match_counted_cmp_loop(Decoded_Instr *group) {
+	return match_sub_cmp_branch(group) && group[0].rd != PC_REG && group[1].imm
+	       && is_loop_back(&group[2], 3);
+}
+
+static bool match_counted_loop(Decoded_Instr *group) {
+	return is_decrement(&group[0]) && group[0].set && group[0].rd != PC_REG
+	       && is_loop_back(&group[1], 2);
+}
+
+// --
+// -- Handlers, entered with the PC of the first instruction of the group
+// --
+
+// Take or skip the branch ending a group, the PC being the branch's own
+static void finish_branch(Machine *arm, Decoded_Instr *branch) {
+	if (!branch->conditional || check_condition(arm, branch)) {
+		arm->pc_reg += branch->operand.sgn_offset + PIPELINE_OFFSET;
+	} else {
+		arm->pc_reg += 4;
+	}
+}
+
+// cmp writing N, Z, C and V in one go rather than flag by flag
+static void compare(Machine *arm, Decoded_Instr *cmp) {
+	uint32_t op1 = arm->general_reg[cmp->rn];
+	uint32_t op2 = decode_operand2(cmp, arm);
+	uint32_t res = op1 - op2;
+	uint32_t flags = (res & N_MASK) | (res ? 0 : Z_MASK) | (op1 >= op2 ? C_MASK : 0)
+	                 | ((op1 ^ op2) & (op1 ^ res) & N_MASK ? V_MASK : 0);
+	arm->cpsr_reg = (arm->cpsr_reg & ~NZCV_MASK) | flags;
+}
+
+static uint64_t run_cmp_branch(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	compare(arm, &group[0]);
+	arm->pc_reg += 4;
+	finish_branch(arm, &group[1]);
+	return 2;
+}
+
+static uint64_t run_sub_cmp_branch(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	data_process(&group[0], arm, arm->data_proc_func);
+	arm->pc_reg += 4;
+	return 1 + run_cmp_branch(arm, &group[1], budget - 1);
+}
+
+static uint64_t run_sub_branch(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	data_process(&group[0], arm, arm->data_proc_func);
+	arm->pc_reg += 4;
+	finish_branch(arm, &group[1]);
+	return 2;
+}
+
+static uint64_t run_ldr_add(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	data_transfer(&group[0], arm);
+	arm->pc_reg += 4;
+	data_process(&group[1], arm, arm->data_proc_func);
+	arm->pc_reg += 4;
+	return 2;
+}
+
+// --
+// -- Counted loops
+// --
+// A loop decrementing rX, comparing it against a constant and branching
+// back while the condition holds only changes rX and the flags, so the
+// iteration that leaves it follows from rX alone. The ones before are
+// skipped by moving rX on; the last runs as usual and sets the flags,
+// the shifter carry and the PC exactly as the full loop would.
+
+// Lowest n >= 1 for which x - n*k == c modulo 2^32, 0 if there is none
+static uint64_t solve_equal(uint32_t x, uint32_t k, uint32_t c) {
+	uint32_t diff = x - c;
+	if (k == 0) {
+		return diff == 0;
+	}
+	uint32_t power = k & -k;        // k = odd * power
+	if (diff % power != 0) {
+		return 0;
+	}
+	uint32_t odd = k / power;
+	uint32_t inverse = odd;         // 3 bits right, doubled by each Newton step
+	for (int i = 0; i < 4; i++) {
+		inverse *= 2 - odd * inverse;
+	}
+	uint64_t period = ((uint64_t) 1 << 32) / power;
+	uint64_t n = (uint32_t) (diff / power * inverse) & (period - 1);
+	return n ? n : period;
+}
+
+// Lowest n >= 1 for which start - n*k < bound, k not 0
+static int64_t first_below(int64_t start, uint32_t k, int64_t bound) {
+	if (start < bound) {
+		return 1;
+	}
+	return (start - bound) / k + 1;
+}
+
+// Iteration on which 'cond' on the compare of rX - n*k against c fails,
+// 0 if the loop never leaves or rX wraps around on the way
+static uint64_t exit_iteration(uint32_t x, uint32_t k, uint32_t c, uint8_t cond) {
+	int64_t n;
+	int64_t start;
+	switch (cond) {
+	case ne:
+		return solve_equal(x, k, c);
+	case hi:
+	case cs:
+		if (k == 0) {
+			return 0;
+		}
+		n = first_below(x, k, cond == hi ? (int64_t) c + 1 : c);
+		return (int64_t) x - n * k >= 0 ? n : 0;
+	case gt:
+	case ge:
+		// V makes the compare exact, so only rX has to stay in range
+		if (k == 0 || k > INT32_MAX) {
+			return 0;
+		}
+		start = (int32_t) x;
+		n = first_below(start, k, cond == gt ? (int64_t) (int32_t) c + 1 : (int32_t) c);
+		return start - n * k >= INT32_MIN ? n : 0;
+	case pl:
+		if (k == 0) {
+			return 0;
+		}
+		// N alone, so the compare result only has the right sign in range
+		start = (int64_t) (int32_t) x - (int32_t) c;
+		n = first_below(start, k, 0);
+		if (start - k > INT32_MAX || start - n * k < INT32_MIN) {
+			return 0;
+		}
+		return n;
+	default:
+		return 0;
+	}
+}
+
+// Move rX past all but the last of 'iterations', keeping the budget for
+// the last one. Returns the instructions skipped.
+static uint64_t skip_iterations(Machine *arm, Decoded_Instr *sub, uint32_t k,
+                                uint64_t iterations, uint8_t length, uint64_t budget) {
+	uint64_t skip = iterations - 1;
+	if (skip > (budget - length) / length) {
+		skip = (budget - length) / length;
+	}
+	arm->general_reg[sub->rd] -= (uint32_t) (skip * k);
+	return skip * length;
+}
+
+static uint64_t run_counted_cmp_loop(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	uint32_t k = group[0].operand.op2;
+	uint32_t c = group[1].operand.op2;
+	uint64_t iterations = exit_iteration(arm->general_reg[group[0].rd], k, c, group[2].cond);
+	uint64_t skipped = iterations ? skip_iterations(arm, &group[0], k, iterations, 3, budget) : 0;
+	return skipped + run_sub_cmp_branch(arm, group, budget - skipped);
+}
+
+// subs sets N and Z as cmp rX,#0 would, and while rX does not wrap V
+// agrees with it too, but C comes from before the decrement
+static uint64_t run_counted_loop(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	uint8_t cond = group[1].cond;
+	uint32_t k = group[0].operand.op2;
+	uint64_t iterations = cond == hi || cond == cs ? 0
+	                      : exit_iteration(arm->general_reg[group[0].rd], k, 0, cond);
+	uint64_t skipped = iterations ? skip_iterations(arm, &group[0], k, iterations, 2, budget) : 0;
+	return skipped + run_sub_branch(arm, group, budget - skipped);
+}
+
+// Nothing changes while the branch loops, so it does for good: take the
+// whole budget, or stop with the PC on the branch when there is none
+static uint64_t run_spin(Machine *arm, Decoded_Instr *group, uint64_t budget) {
+	if (group[0].conditional && !check_condition(arm, &group[0])) {
+		arm->pc_reg += 4;
+		return 1;
+	}
+	arm->fault = ARMEMU_SPIN;
+	arm->fault_addr = arm->pc_reg - PIPELINE_OFFSET;
+	if (budget == UINT64_MAX) {
+		arm->end = true;
+		return 0;
+	}
+	return budget;
+}
+
+// --
+// -- Fusion table, tried in order so longer groups win
+// --
+
+static const Fusion fusions[FUSIONS_NUM] = {
+	[NO_FUSION] = {"none", 1, NULL, NULL},
+	[FUSE_SPIN] = {"b .", 1, match_spin, run_spin},
+	[FUSE_COUNTED_CMP_LOOP] = {"sub+cmp+b loop", 3, match_counted_cmp_loop, run_counted_cmp_loop},
+	[FUSE_COUNTED_LOOP] = {"subs+b loop", 2, match_counted_loop, run_counted_loop},
+	[FUSE_SUB_CMP_BRANCH] = {"sub+cmp+b", 3, match_sub_cmp_branch, run_sub_cmp_branch},
+	[FUSE_CMP_BRANCH] = {"cmp+b", 2, match_cmp_branch, run_cmp_branch},
+	[FUSE_SUB_BRANCH] = {"sub+b", 2, match_sub_branch, run_sub_branch},
+	[FUSE_LDR_ADD] = {"ldr+add", 2, match_ldr_add, run_ldr_add}
+};
+
+void fuse(Machine *arm, uint32_t address) {
+	Decoded_Instr *first = predecode(arm, address);
+	first->fusion_checked = true;
+	for (int i = NO_FUSION + 1; i < FUSIONS_NUM; i++) {
+		uint32_t last = address + 4 * (fusions[i].length - 1);
+		if (last > MEMORY_SIZE - sizeof(uint32_t)) {
+			continue;
+		}
+		for (uint32_t next = address + 4; next <= last; next += 4) {
+			predecode(arm, next);
+		}
+		if (fusions[i].match(first)) {
+			first->fusion = i;
+			return;
+		}
+	}
+}
+
+uint64_t run_fused(Machine *arm, Decoded_Instr *first, uint64_t budget) {
+	arm->fusion_hits[first->fusion]++;
+	return fusions[first->fusion].run(arm, first, budget);
+}
+
+uint8_t fusion_length(enum fusion fusion) {
+	return fusions[fusion].length;
+}
+
+void print_fusion_stats(Machine *arm, FILE *out) {
+	fprintf(out, "Fused groups:\n");
+	for (int i = NO_FUSION + 1; i < FUSIONS_NUM; i++) {
+		fprintf(out, "%-14s: %llu\n", fusions[i].name, (unsigned long long) arm->fusion_hits[i]);
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef ARM11_18_FUSION_H
+#define ARM11_18_FUSION_H
+
+#include <stdio.h>
+#include "define_structures.h"
+
+// --
+// -- Superinstructions
+// --
+// A group of instructions matching an entry of the fusion table is run by
+// one handler, which moves the PC past the group itself instead of going
+// through a pipeline flush. Groups never span a branch: only the last
+// instruction may be one, and only it may be conditional.
+//
+// Loops that only count a register down are groups too: the iterations
+// before the one leaving the loop are skipped in one go, so they cost
+// nothing however long the delay. A branch to itself uses up the budget
+// at once, or stops an unlimited run with ARMEMU_SPIN.
+
+// Check whether a group starts at the predecoded 'address' and record it
+void fuse(Machine *arm, uint32_t address);
+
+// Run the group starting at 'first', executing no more than 'budget'
+// instructions, which is at least FUSION_MAX_LENGTH. Returns the
+// instructions executed.
+uint64_t run_fused(Machine *arm, Decoded_Instr *first, uint64_t budget);
+
+uint8_t fusion_length(enum fusion fusion);
+
+// How often each group has been run
+void print_fusion_stats(Machine *arm, FILE *out);
+
+#endif //ARM11_18_FUSION_H
@@ -0,0 +1,397 @@
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzz.h"
+#include "emulator_processor.h"
+
+#define HAVOC_ROUNDS 256        // mutants of a corpus input per pass over the corpus
+#define HAVOC_MAX_STACK 16      // mutations stacked in a mutant, at most
+#define PROGRESS_EXECS 4096     // execs between looks at the clock
+#define PROGRESS_NS 1000000000  // between progress lines
+
+static const uint8_t interesting_8[] = {0x00, 0x01, 0x10, 0x20, 0x40, 0x64, 0x7f, 0x80, 0xff};
+
+static const uint32_t interesting_32[] = {
+	0, 1, 0x7f, 0x80, 0xff, 0x100, 0x7fff, 0x8000, 0xffff, MEMORY_SIZE - 4, MEMORY_SIZE,
+	0x7fffffff, 0x80000000, 0xffffffff
+};
+
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+// Hit counts to the bit of their bucket: 1, 2, 3, 4-7, 8-15, 16-31,
+// 32-127, 128 and up
+static uint8_t buckets[256];
+
+static volatile sig_atomic_t stopping = 0;
+
+static void stop(int signal) {
+	(void) signal;
+	stopping = 1;
+}
+
+static uint64_t elapsed_ns(const struct timespec *start) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) (now.tv_sec - start->tv_sec) * 1000000000 + now.tv_nsec - start->tv_nsec;
+}
+
+// xorshift64*
+static uint32_t random_below(Fuzz *fuzz, uint32_t limit) {
+	fuzz->rng ^= fuzz->rng >> 12;
+	fuzz->rng ^= fuzz->rng << 25;
+	fuzz->rng ^= fuzz->rng >> 27;
+	return ((fuzz->rng * 0x2545f4914f6cdd1dULL) >> 32) % limit;
+}
+
+// --
+// -- Fuzzer lifetime
+// --
+
+Fuzz *fuzz_create(const Fuzz_Config *config) {
+	if (config->size == 0 || config->address % 4 || config->size % 4
+	    || config->address > MEMORY_SIZE || config->size > MEMORY_SIZE - config->address) {
+		return NULL;
+	}
+	Fuzz *fuzz = calloc(1, sizeof(Fuzz));
+	if (fuzz == NULL) {
+		return NULL;
+	}
+	fuzz->config = *config;
+	fuzz->rng = config->seed * 2 + 1;
+
+	for (int hits = 1; hits < 256; hits++) {
+		int bucket = hits <= 3 ? hits - 1 : hits < 32 ? 32 - __builtin_clz(hits) : hits < 128 ? 6 : 7;
+		buckets[hits] = 1 << bucket;
+	}
+	return fuzz;
+}
+
+void fuzz_destroy(Fuzz *fuzz) {
+	for (uint32_t i = 0; i < fuzz->corpus_count; i++) {
+		free(fuzz->corpus[i].data);
+	}
+	free(fuzz->corpus);
+	free(fuzz->crashes);
+	free(fuzz);
+}
+
+static void save_input(const Fuzz *fuzz, const char *name, const uint8_t *data, uint32_t length) {
+	if (fuzz->config.out_dir == NULL) {
+		return;
+	}
+	char *path = malloc(strlen(fuzz->config.out_dir) + strlen(name) + 2);
+	sprintf(path, "%s/%s", fuzz->config.out_dir, name);
+	FILE *file = fopen(path, "wb");
+	if (file != NULL) {
+		fwrite(data, 1, length, file);
+		fclose(file);
+	}
+	free(path);
+}
+
+static void add_corpus(Fuzz *fuzz, const uint8_t *data, uint32_t length) {
+	if (fuzz->corpus_count == fuzz->corpus_capacity) {
+		fuzz->corpus_capacity = fuzz->corpus_capacity ? 2 * fuzz->corpus_capacity : 64;
+		fuzz->corpus = realloc(fuzz->corpus, fuzz->corpus_capacity * sizeof(Fuzz_Input));
+	}
+	Fuzz_Input *input = &fuzz->corpus[fuzz->corpus_count++];
+	input->length = length;
+	input->data = malloc(length);
+	memcpy(input->data, data, length);
+
+	char name[32];
+	sprintf(name, "queue-%06u", fuzz->corpus_count - 1);
+	save_input(fuzz, name, data, length);
+}
+
+static const char *fault_name(enum armemu_fault fault) {
+	switch (fault) {
+	case ARMEMU_OUT_OF_BOUNDS:
+		return "out of bounds access";
+	case ARMEMU_STACK_LIMIT:
+		return "stack limit exceeded";
+	default:
+		return "PC out of range";
+	}
+}
+
+static void print_crash(const Fuzz_Crash *crash, FILE *out) {
+	fprintf(out, "%s at 0x%08x, pc 0x%08x\n", fault_name(crash->fault), crash->address, crash->pc);
+}
+
+// A crash is new the first time its fault is hit at its PC
+
+static void add_crash(Fuzz *fuzz, const uint8_t *data, uint32_t length, FILE *progress) {
+	Machine *arm = fuzz->arm;
+	Fuzz_Crash crash = {arm->fault, arm->pc_reg - PIPELINE_OFFSET, arm->fault_addr};
+	for (uint32_t i = 0; i < fuzz->crash_count; i++) {
+		if (fuzz->crashes[i].fault == crash.fault && fuzz->crashes[i].pc == crash.pc) {
+			return;
+		}
+	}
+	if (fuzz->crash_count == fuzz->crash_capacity) {
+		fuzz->crash_capacity = fuzz->crash_capacity ? 2 * fuzz->crash_capacity : 16;
+		fuzz->crashes = realloc(fuzz->crashes, fuzz->crash_capacity * sizeof(Fuzz_Crash));
+	}
+	fuzz->crashes[fuzz->crash_count++] = crash;
+
+	char name[32];
+	sprintf(name, "crash-%u-%08x", crash.fault, crash.pc);
+	save_input(fuzz, name, data, length);
+	fprintf(progress, "crash: ");
+	print_crash(&crash, progress);
+}
+
+// --
+// -- Runs
+// --
+
+static void take_snapshot(Fuzz *fuzz) {
+	Machine *arm = fuzz->arm;
+	memcpy(fuzz->memory, arm->memory, MEMORY_SIZE);
+	memcpy(fuzz->general_reg, arm->general_reg, sizeof(fuzz->general_reg));
+	fuzz->cpsr_reg = arm->cpsr_reg;
+	fuzz->pc_reg = arm->pc_reg;
+	fuzz->stack_limit = arm->stack_limit;
+	fuzz->dirty = 0;
+}
+
+// Back to the snapshot with 'data' in the input region. Restoring the
+// region itself is left to the input being written over it.
+
+static void restore(Fuzz *fuzz, const uint8_t *data) {
+	Machine *arm = fuzz->arm;
+	for (uint64_t dirty = fuzz->dirty; dirty; dirty &= dirty - 1) {
+		uint32_t page = __builtin_ctzll(dirty) << FUZZ_PAGE_SHIFT;
+		write_memory(arm, page, &fuzz->memory[page], 1 << FUZZ_PAGE_SHIFT);
+	}
+	write_memory(arm, fuzz->config.address, data, fuzz->config.size);
+	fuzz->dirty = 0;
+
+	memcpy(arm->general_reg, fuzz->general_reg, sizeof(fuzz->general_reg));
+	arm->cpsr_reg = fuzz->cpsr_reg;
+	arm->pc_reg = fuzz->pc_reg;
+	arm->stack_limit = fuzz->stack_limit;
+	arm->end = false;
+	arm->branch_executed = false;
+	arm->shifter_carry = 0;
+	arm->steps = 0;
+	arm->fault = ARMEMU_OK;
+	arm->fault_addr = 0;
+}
+
+// Fold the run's edges into 'seen' and clear them. Returns true if any
+// reached a new bucket.
+
+static bool merge_coverage(Fuzz *fuzz) {
+	bool novel = false;
+	for (uint32_t i = 0; i < fuzz->touched_count; i++) {
+		uint16_t index = fuzz->touched[i];
+		uint8_t bucket = buckets[fuzz->trace[index]];
+		fuzz->trace[index] = 0;
+		if (bucket & ~fuzz->seen[index]) {
+			fuzz->edges += fuzz->seen[index] == 0;
+			fuzz->seen[index] |= bucket;
+			novel = true;
+		}
+	}
+	fuzz->touched_count = 0;
+	return novel;
+}
+
+// 'data' is 'config.size' bytes, zero past 'length'
+
+static void run_input(Fuzz *fuzz, const uint8_t *data, uint32_t length, FILE *progress) {
+	Machine *arm = fuzz->arm;
+	restore(fuzz, data);
+	arm->general_reg[0] = length;
+	arm->general_reg[1] = fuzz->config.address;
+	fuzz->prev = 0;
+
+	armemu_run_limited(arm, fuzz->config.max_steps, 0);
+	fuzz->execs++;
+	bool novel = merge_coverage(fuzz);
+
+	switch (arm->fault) {
+	case ARMEMU_OUT_OF_BOUNDS:
+	case ARMEMU_STACK_LIMIT:
+	case ARMEMU_PC_OUT_OF_RANGE:
+		add_crash(fuzz, data, length, progress);
+		break;
+	case ARMEMU_STEP_LIMIT:
+		fuzz->hangs++;
+		break;
+	default:
+		if (novel) {
+			add_corpus(fuzz, data, length);
+		}
+	}
+}
+
+// --
+// -- Mutations
+// --
+// AFL's havoc stage: a few random edits stacked on a corpus input, the
+// mutant being written to 'out', 'config.size' bytes. Returns its length.
+
+static uint32_t mutate(Fuzz *fuzz, const Fuzz_Input *parent, uint8_t *out) {
+	uint32_t size = fuzz->config.size;
+	uint32_t length = parent->length;
+	memcpy(out, parent->data, length);
+
+	uint32_t stack = 2 << random_below(fuzz, __builtin_ctz(HAVOC_MAX_STACK));
+	for (uint32_t s = 0; s < stack; s++) {
+		uint32_t at = random_below(fuzz, length);
+		uint32_t word;
+		switch (random_below(fuzz, 10)) {
+		case 0:
+			out[at] ^= 1 << random_below(fuzz, 8);
+			break;
+		case 1:
+			out[at] = interesting_8[random_below(fuzz, ARRAY_LENGTH(interesting_8))];
+			break;
+		case 2:
+			if (length >= 4) {
+				word = interesting_32[random_below(fuzz, ARRAY_LENGTH(interesting_32))];
+				memcpy(&out[random_below(fuzz, length - 3)], &word, sizeof(uint32_t));
+			}
+			break;
+		case 3:
+			out[at] += random_below(fuzz, 2) ? 1 + random_below(fuzz, 35) : -1 - random_below(fuzz, 35);
+			break;
+		case 4:
+			if (length >= 4) {
+				at = random_below(fuzz, length - 3);
+				memcpy(&word, &out[at], sizeof(uint32_t));
+				word += random_below(fuzz, 2) ? 1 + random_below(fuzz, 35) : -1 - random_below(fuzz, 35);
+				memcpy(&out[at], &word, sizeof(uint32_t));
+			}
+			break;
+		case 5:
+			out[at] ^= 1 + random_below(fuzz, 255);
+			break;
+		case 6: {
+			// copy a block over another
+			uint32_t count = 1 + random_below(fuzz, length);
+			memmove(&out[random_below(fuzz, length - count + 1)],
+			        &out[random_below(fuzz, length - count + 1)], count);
+			break;
+		}
+		case 7:
+			// delete a block
+			if (length > 1) {
+				uint32_t count = 1 + random_below(fuzz, length - 1);
+				at = random_below(fuzz, length - count + 1);
+				memmove(&out[at], &out[at + count], length - at - count);
+				length -= count;
+			}
+			break;
+		case 8:
+			// append random bytes
+			if (length < size) {
+				uint32_t count = 1 + random_below(fuzz, size - length);
+				for (uint32_t i = 0; i < count; i++) {
+					out[length++] = random_below(fuzz, 256);
+				}
+			}
+			break;
+		default: {
+			// splice the tail of another input on
+			const Fuzz_Input *other = &fuzz->corpus[random_below(fuzz, fuzz->corpus_count)];
+			uint32_t shortest = length < other->length ? length : other->length;
+			at = random_below(fuzz, shortest);
+			memcpy(&out[at], &other->data[at], other->length - at);
+			length = other->length;
+			break;
+		}
+		}
+	}
+	memset(&out[length], 0, size - length);
+	return length;
+}
+
+// --
+// -- Fuzzing loop
+// --
+
+static void print_progress(const Fuzz *fuzz, FILE *out) {
+	double seconds = elapsed_ns(&fuzz->start) / 1e9;
+	fprintf(out, "execs %llu (%.0f/s), edges %u, corpus %u, crashes %u, hangs %llu\n",
+	        (unsigned long long) fuzz->execs, fuzz->execs / seconds, fuzz->edges,
+	        fuzz->corpus_count, fuzz->crash_count, (unsigned long long) fuzz->hangs);
+}
+
+// Feed 'arm' runs to 'fuzz', NULL to stop. Returns false if the hooks are
+// not built in.
+static bool attach(Machine *arm, Fuzz *fuzz) {
+#ifdef ARMEMU_FUZZ
+	arm->fuzz = fuzz;
+	return true;
+#else
+	(void) arm;
+	(void) fuzz;
+	return false;
+#endif
+}
+
+bool fuzz_run(Fuzz *fuzz, Machine *arm, FILE *progress) {
+	if (!attach(arm, fuzz)) {
+		return false;
+	}
+	uint32_t size = fuzz->config.size;
+	uint8_t *mutant = malloc(size);
+	fuzz->arm = arm;
+	take_snapshot(fuzz);
+	clock_gettime(CLOCK_MONOTONIC, &fuzz->start);
+
+	struct sigaction action;
+	struct sigaction previous;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = stop;
+	sigaction(SIGINT, &action, &previous);
+	stopping = 0;
+
+	// the region as loaded is the first input, kept whatever it reaches
+	memcpy(mutant, &fuzz->memory[fuzz->config.address], size);
+	run_input(fuzz, mutant, size, progress);
+	if (fuzz->corpus_count == 0) {
+		add_corpus(fuzz, mutant, size);
+	}
+
+	uint64_t last_progress = 0;
+	while (fuzz->execs < fuzz->config.runs && !stopping) {
+		for (uint32_t entry = 0; entry < fuzz->corpus_count; entry++) {
+			for (int round = 0; round < HAVOC_ROUNDS && fuzz->execs < fuzz->config.runs; round++) {
+				uint32_t length = mutate(fuzz, &fuzz->corpus[entry], mutant);
+				run_input(fuzz, mutant, length, progress);
+				if (fuzz->execs % PROGRESS_EXECS == 0 && elapsed_ns(&fuzz->start) - last_progress >= PROGRESS_NS) {
+					last_progress = elapsed_ns(&fuzz->start);
+					print_progress(fuzz, progress);
+				}
+			}
+			if (fuzz->execs >= fuzz->config.runs || stopping) {
+				break;
+			}
+		}
+	}
+
+	sigaction(SIGINT, &previous, NULL);
+	attach(arm, NULL);
+	free(mutant);
+	return true;
+}
+
+void print_fuzz_report(const Fuzz *fuzz, FILE *out) {
+	double seconds = elapsed_ns(&fuzz->start) / 1e9;
+	fprintf(out, "Fuzzing: %llu execs in %.2f s, %.0f execs/s\n",
+	        (unsigned long long) fuzz->execs, seconds, fuzz->execs / seconds);
+	fprintf(out, "Edges   : %u\n", fuzz->edges);
+	fprintf(out, "Corpus  : %u inputs\n", fuzz->corpus_count);
+	fprintf(out, "Hangs   : %llu\n", (unsigned long long) fuzz->hangs);
+	fprintf(out, "Crashes : %u\n", fuzz->crash_count);
+	for (uint32_t i = 0; i < fuzz->crash_count; i++) {
+		fprintf(out, "  ");
+		print_crash(&fuzz->crashes[i], out);
+	}
+}
@@ -0,0 +1,131 @@
+#ifndef ARM11_18_FUZZ_H
+#define ARM11_18_FUZZ_H
+
+#include <stdio.h>
+#include <time.h>
+#include "define_structures.h"
+
+// --
+// -- Coverage-guided fuzzing
+// --
+// Runs the loaded image over and over in the same machine, each run with
+// a mutated input written to a region of guest memory, r0 holding its
+// length and r1 its address. Edges between basic blocks are counted in
+// an AFL-style 64KB bitmap as branches are taken or fall through and as
+// the PC is loaded; inputs reaching new edges, or known edges a new
+// power of two number of times, join the corpus mutated from.
+//
+// Between runs only the memory pages stored to are restored from the
+// snapshot taken before the first, along with the registers, so the
+// decode cache stays warm. Out of bounds transfers, stack limit
+// violations and fetches outside memory end the run as crashes, reported
+// once per fault and PC; runs reaching the step limit are hangs.
+//
+// The hooks are only built in with 'make FUZZ=1', which defines
+// ARMEMU_FUZZ; nothing is fused while fuzzing, as fused groups skip the
+// branches they run.
+
+#define FUZZ_MAP_SIZE (1 << 16)
+#define FUZZ_PAGE_SHIFT 10              // 64 pages, one bit each in 'dirty'
+#define FUZZ_DEFAULT_RUNS 1000000
+#define FUZZ_DEFAULT_STEPS 100000
+
+struct Fuzz_Config {
+	uint32_t address;       // input region, inside guest memory
+	uint32_t size;          // longest input
+	uint64_t runs;
+	uint64_t max_steps;     // per run
+	uint64_t seed;
+	const char *out_dir;    // crashes and the corpus are saved here, if not NULL
+};
+typedef struct Fuzz_Config Fuzz_Config;
+
+struct Fuzz_Input {
+	uint32_t length;
+	uint8_t *data;
+};
+typedef struct Fuzz_Input Fuzz_Input;
+
+// First input to hit a fault at a PC
+struct Fuzz_Crash {
+	enum armemu_fault fault;
+	uint32_t pc;
+	uint32_t address;       // fault address
+};
+typedef struct Fuzz_Crash Fuzz_Crash;
+
+struct Fuzz {
+	Fuzz_Config config;
+	Machine *arm;
+
+	// this run's edges, and their indices in the order first hit
+	uint32_t prev;                  // last block's location, shifted right once
+	uint8_t trace[FUZZ_MAP_SIZE];
+	uint16_t touched[FUZZ_MAP_SIZE];
+	uint32_t touched_count;
+	uint8_t seen[FUZZ_MAP_SIZE];    // hit count buckets reached so far, a bit each
+	uint32_t edges;
+
+	// state to restore between runs
+	uint64_t dirty;                 // pages stored to
+	uint8_t memory[MEMORY_SIZE];
+	uint32_t general_reg[GENERAL_REGISTERS_NUM];
+	uint32_t cpsr_reg;
+	uint32_t pc_reg;
+	uint32_t stack_limit;
+
+	Fuzz_Input *corpus;
+	uint32_t corpus_count;
+	uint32_t corpus_capacity;
+	Fuzz_Crash *crashes;
+	uint32_t crash_count;
+	uint32_t crash_capacity;
+
+	uint64_t rng;
+	uint64_t execs;
+	uint64_t hangs;
+	struct timespec start;
+};
+typedef struct Fuzz Fuzz;
+
+// Allocate a fuzzer. Returns NULL if the input region is outside guest
+// memory or out of memory.
+Fuzz *fuzz_create(const Fuzz_Config *config);
+
+void fuzz_destroy(Fuzz *fuzz);
+
+// Fuzz the image loaded in 'arm', its input region as the first seed.
+// Returns false if the emulator was built without ARMEMU_FUZZ.
+bool fuzz_run(Fuzz *fuzz, Machine *arm, FILE *progress);
+
+// Execs, coverage, corpus and the crashes found
+void print_fuzz_report(const Fuzz *fuzz, FILE *out);
+
+// The edge from the last block to the one at 'to'
+static inline void fuzz_edge(Fuzz *fuzz, uint32_t to) {
+	uint32_t location = ((to >> 2) * 0x9e3779b1u) >> 16;
+	uint32_t index = (location ^ fuzz->prev) & (FUZZ_MAP_SIZE - 1);
+	uint8_t hits = fuzz->trace[index];
+	if (hits == 0) {
+		fuzz->touched[fuzz->touched_count++] = index;
+	}
+	fuzz->trace[index] = hits + (hits != 0xff);
+	fuzz->prev = location >> 1;
+}
+
+#ifdef ARMEMU_FUZZ
+#define FUZZ_ATTACHED(arm) ((arm)->fuzz != NULL)
+#define FUZZ_EDGE(arm, to) \
+	do { if ((arm)->fuzz) fuzz_edge((arm)->fuzz, to); } while (0)
+#define FUZZ_DIRTY(arm, address) \
+	do { if ((arm)->fuzz) (arm)->fuzz->dirty |= 1ull << ((address) >> FUZZ_PAGE_SHIFT); } while (0)
+#define FUZZ_CRASH(arm) \
+	do { if ((arm)->fuzz) (arm)->end = true; } while (0)
+#else
+#define FUZZ_ATTACHED(arm) false
+#define FUZZ_EDGE(arm, to) ((void) 0)
+#define FUZZ_DIRTY(arm, address) ((void) 0)
+#define FUZZ_CRASH(arm) ((void) 0)
+#endif
+
+#endif //ARM11_18_FUZZ_H
@@ -0,0 +1,572 @@
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "gdbstub.h"
+#include "armemu.h"
+#include "emulator_processor.h"
+
+#define GDB_INTERRUPT 0x03
+#define GDB_PC_REGNUM 15
+#define GDB_CPSR_REGNUM 25              // past the FPA registers, which are left out
+#define GDB_REGISTERS_SIZE (17 * 4)     // r0 - r15 and cpsr in a 'g' packet
+#define STOP_SIZE 32
+
+#define GDB_SIGINT 2
+#define GDB_SIGTRAP 5
+#define GDB_SIGSEGV 11
+
+static const char target_xml[] =
+	"<?xml version=\"1.0\"?>"
+	"<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+	"<target version=\"1.0\">"
+	"<architecture>arm</architecture>"
+	"<feature name=\"org.gnu.gdb.arm.core\">"
+	"<reg name=\"r0\" bitsize=\"32\"/>"
+	"<reg name=\"r1\" bitsize=\"32\"/>"
+	"<reg name=\"r2\" bitsize=\"32\"/>"
+	"<reg name=\"r3\" bitsize=\"32\"/>"
+	"<reg name=\"r4\" bitsize=\"32\"/>"
+	"<reg name=\"r5\" bitsize=\"32\"/>"
+	"<reg name=\"r6\" bitsize=\"32\"/>"
+	"<reg name=\"r7\" bitsize=\"32\"/>"
+	"<reg name=\"r8\" bitsize=\"32\"/>"
+	"<reg name=\"r9\" bitsize=\"32\"/>"
+	"<reg name=\"r10\" bitsize=\"32\"/>"
+	"<reg name=\"r11\" bitsize=\"32\"/>"
+	"<reg name=\"r12\" bitsize=\"32\"/>"
+	"<reg name=\"sp\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"lr\" bitsize=\"32\"/>"
+	"<reg name=\"pc\" bitsize=\"32\" type=\"code_ptr\"/>"
+	"<reg name=\"cpsr\" bitsize=\"32\" regnum=\"25\"/>"
+	"</feature>"
+	"</target>";
+
+struct Gdb {
+	Machine *arm;
+	int fd;
+	bool ack;                       // until QStartNoAckMode
+	char stop[STOP_SIZE];           // reply to '?', the last stop
+
+	char input[GDB_PACKET_SIZE];    // read from the socket, from 'position' on not yet used
+	size_t length;
+	size_t position;
+
+	char packet[GDB_PACKET_SIZE];
+	char reply[GDB_PACKET_SIZE];
+};
+typedef struct Gdb Gdb;
+
+// --
+// -- Hex
+// --
+
+static const char hex_digits[] = "0123456789abcdef";
+
+static int hex_value(int c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+	return -1;
+}
+
+static char *put_hex(char *out, const uint8_t *bytes, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		*out++ = hex_digits[bytes[i] >> 4];
+		*out++ = hex_digits[bytes[i] & 0xf];
+	}
+	*out = '\0';
+	return out;
+}
+
+// Exactly 2 * 'length' digits
+static bool get_hex(const char *in, uint8_t *bytes, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		int high = hex_value(in[2 * i]);
+		int low = high < 0 ? -1 : hex_value(in[2 * i + 1]);
+		if (low < 0) {
+			return false;
+		}
+		bytes[i] = high << 4 | low;
+	}
+	return in[2 * length] == '\0';
+}
+
+// Words go over the wire in target order, little-endian
+static char *put_word(char *out, uint32_t word) {
+	uint8_t bytes[4] = {word, word >> 8, word >> 16, word >> 24};
+	return put_hex(out, bytes, sizeof(bytes));
+}
+
+static uint32_t get_word(const uint8_t *bytes) {
+	return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t) bytes[3] << 24;
+}
+
+static bool parse_hex(const char *in, char **end, uint32_t *value) {
+	*value = strtoul(in, end, 16);
+	return *end != in;
+}
+
+// --
+// -- Packets
+// --
+
+static int read_byte(Gdb *gdb) {
+	if (gdb->position == gdb->length) {
+		ssize_t got;
+		do {
+			got = read(gdb->fd, gdb->input, GDB_PACKET_SIZE);
+		} while (got < 0 && errno == EINTR);
+		if (got <= 0) {
+			return EOF;
+		}
+		gdb->length = got;
+		gdb->position = 0;
+	}
+	return (unsigned char) gdb->input[gdb->position++];
+}
+
+static bool write_all(int fd, const char *data, size_t length) {
+	while (length) {
+		ssize_t sent = write(fd, data, length);
+		if (sent < 0 && errno == EINTR) {
+			continue;
+		}
+		if (sent <= 0) {
+			return false;
+		}
+		data += sent;
+		length -= sent;
+	}
+	return true;
+}
+
+// Read the next packet into 'packet', acknowledging it. Returns false
+// when the debugger has gone.
+static bool receive_packet(Gdb *gdb) {
+	for (;;) {
+		int c;
+		do {
+			c = read_byte(gdb);     // <- skips acks, and interrupts while stopped
+		} while (c != '$' && c != EOF);
+		size_t length = 0;
+		uint8_t sum = 0;
+		while (c != EOF && (c = read_byte(gdb)) != '#' && c != EOF) {
+			sum += c;
+			if (length < GDB_PACKET_SIZE - 1) {
+				gdb->packet[length++] = c;
+			}
+		}
+		int high = c == EOF ? EOF : read_byte(gdb);
+		int low = high == EOF ? EOF : read_byte(gdb);
+		if (low == EOF) {
+			return false;
+		}
+		gdb->packet[length] = '\0';
+		bool valid = hex_value(high) >= 0 && hex_value(low) >= 0
+		             && (hex_value(high) << 4 | hex_value(low)) == sum;
+		if (gdb->ack && !write_all(gdb->fd, valid ? "+" : "-", 1)) {
+			return false;
+		}
+		if (valid) {
+			return true;
+		}
+	}
+}
+
+// Send 'data', again until acknowledged
+static bool send_packet(Gdb *gdb, const char *data) {
+	char frame[GDB_PACKET_SIZE + 4];
+	size_t length = strlen(data);
+	uint8_t sum = 0;
+	for (size_t i = 0; i < length; i++) {
+		sum += data[i];
+	}
+	frame[0] = '$';
+	memcpy(&frame[1], data, length);
+	sprintf(&frame[length + 1], "#%02x", sum);
+	for (;;) {
+		if (!write_all(gdb->fd, frame, length + 4)) {
+			return false;
+		}
+		if (!gdb->ack) {
+			return true;
+		}
+		int c;
+		do {
+			c = read_byte(gdb);
+		} while (c != '+' && c != '-' && c != EOF);
+		if (c != '-') {
+			return c == '+';
+		}
+	}
+}
+
+// --
+// -- Machine state
+// --
+
+static bool is_register(uint32_t reg) {
+	return reg <= GDB_PC_REGNUM || reg == GDB_CPSR_REGNUM;
+}
+
+static uint32_t read_register(const Machine *arm, uint32_t reg) {
+	if (reg == GDB_PC_REGNUM) {
+		return arm->pc_reg - PIPELINE_OFFSET;
+	}
+	if (reg == GDB_CPSR_REGNUM) {
+		return arm->cpsr_reg;
+	}
+	return arm->general_reg[reg];
+}
+
+static void write_register(Machine *arm, uint32_t reg, uint32_t value) {
+	if (reg == GDB_PC_REGNUM) {
+		arm->pc_reg = value + PIPELINE_OFFSET;
+	} else if (reg == GDB_CPSR_REGNUM) {
+		arm->cpsr_reg = value;
+	} else {
+		arm->general_reg[reg] = value;
+	}
+}
+
+// A write from the debugger is not a guest store: it drops the decoded
+// instructions and keeps breakpoints, but trips no watchpoint
+static void write_guest(Machine *arm, uint32_t address, const uint8_t *data, uint32_t length) {
+	memcpy(&arm->memory[address], data, length);
+	armemu_invalidate(arm, address, length);
+}
+
+// Parse 'address,length' and check it lies in guest memory
+static bool parse_range(const char *in, char **end, uint32_t *address, uint32_t *length) {
+	return parse_hex(in, end, address) && **end == ',' && parse_hex(*end + 1, end, length)
+	       && *address <= MEMORY_SIZE && *length <= MEMORY_SIZE - *address;
+}
+
+// --
+// -- Running
+// --
+
+// A byte from the debugger while running can only be an interrupt
+static bool interrupted(Gdb *gdb) {
+	struct pollfd waiting = {gdb->fd, POLLIN, 0};
+	if (gdb->position == gdb->length && poll(&waiting, 1, 0) <= 0) {
+		return false;
+	}
+	int c = read_byte(gdb);
+	return c == GDB_INTERRUPT || c == EOF;
+}
+
+static void resume_target(Gdb *gdb, bool single) {
+	Machine *arm = gdb->arm;
+	bool stopped = false;
+	armemu_step(arm, single ? 1 : GDB_RUN_CHUNK);     // <- carries on from a breakpoint or watchpoint
+	while (!single && !arm->end && !(stopped = interrupted(gdb))) {
+		armemu_step(arm, GDB_RUN_CHUNK);
+	}
+
+	if (!arm->end) {
+		sprintf(gdb->stop, "S%02x", stopped ? GDB_SIGINT : GDB_SIGTRAP);
+		return;
+	}
+	switch (arm->fault) {
+	case ARMEMU_BREAKPOINT:
+		sprintf(gdb->stop, "S%02x", GDB_SIGTRAP);
+		break;
+	case ARMEMU_WATCHPOINT:
+		sprintf(gdb->stop, "T%02xwatch:%x;", GDB_SIGTRAP, arm->fault_addr);
+		break;
+	case ARMEMU_PC_OUT_OF_RANGE:
+	case ARMEMU_STACK_LIMIT:
+		sprintf(gdb->stop, "S%02x", GDB_SIGSEGV);
+		break;
+	default:
+		strcpy(gdb->stop, "W00");     // <- halted
+	}
+}
+
+// --
+// -- Commands
+// --
+
+static bool has_prefix(const char *packet, const char *prefix) {
+	return !strncmp(packet, prefix, strlen(prefix));
+}
+
+static void query(const char *packet, char *reply) {
+	const char *features = "qXfer:features:read:target.xml:";
+	if (has_prefix(packet, "qSupported")) {
+		sprintf(reply, "PacketSize=%x;qXfer:features:read+;QStartNoAckMode+", GDB_PACKET_SIZE - 1);
+	} else if (has_prefix(packet, features)) {
+		char *end;
+		uint32_t offset;
+		uint32_t length;
+		if (!parse_hex(packet + strlen(features), &end, &offset) || *end != ','
+		    || !parse_hex(end + 1, &end, &length)) {
+			strcpy(reply, "E01");
+			return;
+		}
+		uint32_t size = strlen(target_xml);
+		offset = offset < size ? offset : size;
+		length = length < size - offset ? length : size - offset;
+		length = length < GDB_PACKET_SIZE - 2 ? length : GDB_PACKET_SIZE - 2;
+		reply[0] = offset + length < size ? 'm' : 'l';
+		memcpy(&reply[1], &target_xml[offset], length);
+		reply[length + 1] = '\0';
+	} else if (!strcmp(packet, "qAttached")) {
+		strcpy(reply, "1");
+	} else if (!strcmp(packet, "qC")) {
+		strcpy(reply, "QC1");
+	} else if (!strcmp(packet, "qfThreadInfo")) {
+		strcpy(reply, "m1");
+	} else if (!strcmp(packet, "qsThreadInfo")) {
+		strcpy(reply, "l");
+	} else if (has_prefix(packet, "qSymbol")) {
+		strcpy(reply, "OK");
+	}
+}
+
+// Z and z: breakpoints, kinds 0 and 1, and write watchpoints, kind 2
+static void set_point(Gdb *gdb, const char *packet, char *reply) {
+	Machine *arm = gdb->arm;
+	bool set = packet[0] == 'Z';
+	char *end;
+	uint32_t address;
+	uint32_t length;
+	if (packet[1] < '0' || packet[1] > '2') {
+		return;         // <- read and access watchpoints are not supported
+	}
+	if (packet[2] != ',' || !parse_hex(packet + 3, &end, &address) || *end != ','
+	    || !parse_hex(end + 1, &end, &length)) {
+		strcpy(reply, "E01");
+		return;
+	}
+	bool done;
+	if (packet[1] == '2') {
+		done = set ? armemu_set_watchpoint(arm, address, length)
+		           : armemu_clear_watchpoint(arm, address, length);
+	} else {
+		done = set ? armemu_set_breakpoint(arm, address) : armemu_clear_breakpoint(arm, address);
+	}
+	strcpy(reply, done || !set ? "OK" : "E01");
+}
+
+// Reply to one packet. Returns false when the session is over.
+static bool run_packet(Gdb *gdb) {
+	Machine *arm = gdb->arm;
+	const char *packet = gdb->packet;
+	char *reply = gdb->reply;
+	uint8_t data[GDB_PACKET_SIZE / 2];
+	char *end;
+	uint32_t address;
+	uint32_t length;
+	reply[0] = '\0';
+
+	switch (packet[0]) {
+	case '?':
+		strcpy(reply, gdb->stop);
+		break;
+	case 'g': {
+		char *out = reply;
+		for (uint32_t reg = 0; reg <= GDB_PC_REGNUM; reg++) {
+			out = put_word(out, read_register(arm, reg));
+		}
+		put_word(out, read_register(arm, GDB_CPSR_REGNUM));
+		break;
+	}
+	case 'G':
+		if (!get_hex(packet + 1, data, GDB_REGISTERS_SIZE)) {
+			strcpy(reply, "E01");
+			break;
+		}
+		for (uint32_t reg = 0; reg <= GDB_PC_REGNUM; reg++) {
+			write_register(arm, reg, get_word(&data[reg * 4]));
+		}
+		write_register(arm, GDB_CPSR_REGNUM, get_word(&data[GDB_REGISTERS_SIZE - 4]));
+		strcpy(reply, "OK");
+		break;
+	case 'p':
+		if (!parse_hex(packet + 1, &end, &address) || *end != '\0' || !is_register(address)) {
+			strcpy(reply, "E01");
+			break;
+		}
+		put_word(reply, read_register(arm, address));
+		break;
+	case 'P':
+		if (!parse_hex(packet + 1, &end, &address) || *end != '=' || !is_register(address)
+		    || !get_hex(end + 1, data, 4)) {
+			strcpy(reply, "E01");
+			break;
+		}
+		write_register(arm, address, get_word(data));
+		strcpy(reply, "OK");
+		break;
+	case 'm':
+		if (!parse_range(packet + 1, &end, &address, &length) || *end != '\0') {
+			strcpy(reply, "E01");
+			break;
+		}
+		length = length < GDB_PACKET_SIZE / 2 - 1 ? length : GDB_PACKET_SIZE / 2 - 1;
+		put_hex(reply, &arm->memory[address], length);
+		break;
+	case 'M':
+		if (!parse_range(packet + 1, &end, &address, &length) || *end != ':'
+		    || length > sizeof(data) || !get_hex(end + 1, data, length)) {
+			strcpy(reply, "E01");
+			break;
+		}
+		write_guest(arm, address, data, length);
+		strcpy(reply, "OK");
+		break;
+	case 'c':
+	case 's':
+		if (packet[1] != '\0') {
+			if (!parse_hex(packet + 1, &end, &address)) {
+				strcpy(reply, "E01");
+				break;
+			}
+			write_register(arm, GDB_PC_REGNUM, address);
+		}
+		resume_target(gdb, packet[0] == 's');
+		strcpy(reply, gdb->stop);
+		break;
+	case 'Z':
+	case 'z':
+		set_point(gdb, packet, reply);
+		break;
+	case 'H':
+	case 'T':
+		strcpy(reply, "OK");  // <- one thread
+		break;
+	case 'q':
+		query(packet, reply);
+		break;
+	case 'Q':
+		if (!strcmp(packet, "QStartNoAckMode")) {
+			bool sent = send_packet(gdb, "OK");
+			gdb->ack = false;
+			return sent;
+		}
+		break;
+	case 'D':
+		send_packet(gdb, "OK");
+		return false;
+	case 'k':
+		return false;
+	default:
+		break;          // <- the empty reply, not supported
+	}
+	return send_packet(gdb, reply);
+}
+
+// --
+// -- Connection
+// --
+
+// Close 'fd' after a failed call, keeping its errno
+static int failed(int fd) {
+	int error = errno;
+	close(fd);
+	errno = error;
+	return -1;
+}
+
+static int listen_tcp(const char *port_string) {
+	char *end;
+	unsigned long port = strtoul(port_string, &end, 10);
+	if (*end != '\0' || end == port_string || port == 0 || port > 65535) {
+		errno = EINVAL;
+		return -1;
+	}
+	struct sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	int fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0) {
+		return -1;
+	}
+	int on = 1;
+	if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on))
+	    || bind(fd, (struct sockaddr *) &address, sizeof(address)) || listen(fd, 1)) {
+		return failed(fd);
+	}
+	return fd;
+}
+
+static int listen_unix(const char *path) {
+	struct sockaddr_un address;
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		return -1;
+	}
+	unlink(path);
+	if (bind(fd, (struct sockaddr *) &address, sizeof(address)) || listen(fd, 1)) {
+		return failed(fd);
+	}
+	return fd;
+}
+
+int gdb_serve(Machine *arm, const char *address) {
+	bool tcp = address[0] == ':';
+	int listener = tcp ? listen_tcp(address + 1) : listen_unix(address);
+	if (listener < 0) {
+		fprintf(stderr,"Could not listen on %s: %s",address,strerror(errno));
+		return EXIT_FAILURE;
+	}
+	signal(SIGPIPE, SIG_IGN);
+	fprintf(stderr,"Waiting for GDB on %s\n",address);
+	int fd;
+	do {
+		fd = accept(listener, NULL, NULL);
+	} while (fd < 0 && errno == EINTR);
+	close(listener);
+	if (!tcp) {
+		unlink(address);
+	}
+	if (fd < 0) {
+		fprintf(stderr,"accept failed: %s\n",strerror(errno));
+		return EXIT_FAILURE;
+	}
+	if (tcp) {
+		int on = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+	}
+
+	static Gdb gdb;
+	gdb.arm = arm;
+	gdb.fd = fd;
+	gdb.ack = true;
+	sprintf(gdb.stop, "S%02x", GDB_SIGTRAP);
+	bool attached = true;
+	while (attached && receive_packet(&gdb)) {
+		attached = run_packet(&gdb);
+	}
+	close(fd);
+	return EXIT_SUCCESS;
+}
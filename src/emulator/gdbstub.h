@@ -0,0 +1,30 @@
+#ifndef ARM11_18_GDBSTUB_H
+#define ARM11_18_GDBSTUB_H
+
+#include "define_structures.h"
+
+// --
+// -- GDB remote stub
+// --
+// 'emulate --gdb=...' serves the loaded program to one debugger over the
+// GDB remote serial protocol, 'target remote' in GDB. The address is
+// ':port' for TCP on 127.0.0.1, or the path of a Unix socket.
+//
+// Registers are r0 - r15 and cpsr, read and written straight from the
+// machine, with the PC as GDB expects it, on the instruction to run next.
+// Memory is guest memory. Breakpoints and write watchpoints map onto the
+// machine's own (see armemu.h), so running between them is as fast as a
+// plain run; read and access watchpoints are not supported. 'continue'
+// runs in chunks of GDB_RUN_CHUNK instructions, looking for an interrupt
+// from the debugger between them.
+//
+// A halt is reported as the program exiting with code 0, and a fetch
+// outside memory or a stack overflow as SIGSEGV.
+
+#define GDB_PACKET_SIZE 4096
+#define GDB_RUN_CHUNK (1 << 20)
+
+// Serve one debugger connection on 'address'. Returns the exit code.
+int gdb_serve(Machine *arm, const char *address);
+
+#endif //ARM11_18_GDBSTUB_H
@@ -0,0 +1,107 @@
+#include <string.h>
+
+#include "gpio.h"
+
+// register offsets
+#define GPFSEL0 0x00
+#define GPFSEL5 0x14
+#define GPSET0 0x1c
+#define GPSET1 0x20
+#define GPCLR0 0x28
+#define GPCLR1 0x2c
+#define GPLEV0 0x34
+#define GPLEV1 0x38
+
+#define PINS_PER_SELECT 10
+#define PINS_PER_BANK 32
+
+static void record(Gpio *gpio, enum gpio_event_type type, uint8_t first_pin, uint32_t pins) {
+	if (gpio->event_count == GPIO_EVENT_BUFFER) {
+		gpio_flush(gpio);
+	}
+	Gpio_Event *event = &gpio->events[gpio->event_count++];
+	event->step = gpio->arm->steps;
+	event->type = type;
+	event->first_pin = first_pin;
+	event->pins = pins;
+}
+
+static void select_accessed(Gpio *gpio, uint32_t offset) {
+	uint8_t first_pin = (offset - GPFSEL0) / 4 * PINS_PER_SELECT;
+	record(gpio, GPIO_SELECT, first_pin, (1 << PINS_PER_SELECT) - 1);
+}
+
+static uint32_t gpio_read(void *device, uint32_t offset) {
+	Gpio *gpio = device;
+	switch (offset) {
+	case GPLEV0:
+		return gpio->level;
+	case GPLEV1:
+		return gpio->level >> PINS_PER_BANK;
+	default:
+		break;
+	}
+	if (offset <= GPFSEL5) {
+		select_accessed(gpio, offset);
+		return gpio->function_select[offset / 4];
+	}
+	return 0;       // set/clear registers are write-only
+}
+
+static void gpio_write(void *device, uint32_t offset, uint32_t value) {
+	Gpio *gpio = device;
+	switch (offset) {
+	case GPSET0:
+		gpio->level |= value;
+		record(gpio, GPIO_SET, 0, value);
+		return;
+	case GPSET1:
+		gpio->level |= (uint64_t) value << PINS_PER_BANK;
+		record(gpio, GPIO_SET, PINS_PER_BANK, value);
+		return;
+	case GPCLR0:
+		gpio->level &= ~(uint64_t) value;
+		record(gpio, GPIO_CLEAR, 0, value);
+		return;
+	case GPCLR1:
+		gpio->level &= ~((uint64_t) value << PINS_PER_BANK);
+		record(gpio, GPIO_CLEAR, PINS_PER_BANK, value);
+		return;
+	default:
+		break;
+	}
+	if (offset <= GPFSEL5) {
+		select_accessed(gpio, offset);
+		gpio->function_select[offset / 4] = value;
+	}
+}
+
+bool gpio_attach(Gpio *gpio, Machine *arm, FILE *log) {
+	memset(gpio, 0, sizeof(Gpio));
+	gpio->arm = arm;
+	gpio->log = log;
+	return armemu_map_device(arm, GPIO_BASE, GPIO_SIZE, gpio_read, gpio_write, gpio);
+}
+
+// Written in the messages the reference emulator prints for GPIO accesses
+
+void gpio_flush(Gpio *gpio) {
+	if (gpio->log != NULL) {
+		for (uint32_t i = 0; i < gpio->event_count; i++) {
+			Gpio_Event *event = &gpio->events[i];
+			switch (event->type) {
+			case GPIO_SELECT:
+				fprintf(gpio->log, "One GPIO pin from %d to %d has been accessed\n",
+				        event->first_pin, event->first_pin + PINS_PER_SELECT - 1);
+				break;
+			case GPIO_SET:
+				fprintf(gpio->log, "PIN ON\n");
+				break;
+			case GPIO_CLEAR:
+				fprintf(gpio->log, "PIN OFF\n");
+				break;
+			}
+		}
+	}
+	gpio->event_count = 0;
+}
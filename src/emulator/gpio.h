@@ -0,0 +1,50 @@
+#ifndef ARM11_18_GPIO_H
+#define ARM11_18_GPIO_H
+
+#include <stdio.h>
+#include "define_structures.h"
+
+// --
+// -- Raspberry Pi GPIO controller (BCM2835 layout)
+// --
+
+#define GPIO_BASE 0x20200000
+#define GPIO_SIZE 0xb4
+#define GPIO_PINS 54
+
+#define GPIO_EVENT_BUFFER 256
+
+enum gpio_event_type {
+	GPIO_SELECT, // function select register accessed
+	GPIO_SET,
+	GPIO_CLEAR
+};
+
+struct Gpio_Event {
+	uint64_t step;          // instructions executed before the access
+	enum gpio_event_type type;
+	uint8_t first_pin;      // pin of bit 0 of 'pins'
+	uint32_t pins;          // pins set/cleared, or the pins of a select register
+};
+typedef struct Gpio_Event Gpio_Event;
+
+// Events are buffered and written to 'log' whenever the buffer fills up
+// and on gpio_flush(); a NULL log only keeps the latest buffer.
+
+struct Gpio {
+	Machine *arm;
+	uint32_t function_select[6];
+	uint64_t level;
+	Gpio_Event events[GPIO_EVENT_BUFFER];
+	uint32_t event_count;
+	FILE *log;
+};
+typedef struct Gpio Gpio;
+
+// Map the controller at GPIO_BASE in 'arm'. Returns false if it could not
+// be mapped.
+bool gpio_attach(Gpio *gpio, Machine *arm, FILE *log);
+
+void gpio_flush(Gpio *gpio);
+
+#endif //ARM11_18_GPIO_H
@@ -0,0 +1,370 @@
+#define _GNU_SOURCE     // F_SETSIG, F_SETOWN_EX and siginfo's si_fd
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "host_perf.h"
+#include "emulator_processor.h"
+
+#define HOST_PERF_SIGNAL SIGIO
+#define HOST_PERF_TOP_BLOCKS 20
+
+struct Host_Event {
+	const char *name;
+	uint32_t type;
+	uint64_t config;
+	uint64_t period;        // events between samples
+};
+typedef struct Host_Event Host_Event;
+
+static const Host_Event host_events[HOST_EVENTS_NUM] = {
+	[HOST_CYCLES] = {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 1000003},
+	[HOST_INSTRUCTIONS] = {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 1000003},
+	[HOST_BRANCH_MISSES] = {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, 10007},
+	[HOST_L1D_MISSES] = {"L1D-misses", PERF_TYPE_HW_CACHE,
+	                     PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8
+	                     | PERF_COUNT_HW_CACHE_RESULT_MISS << 16, 10007},
+	[HOST_TASK_CLOCK] = {"task-clock", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, 1000000}
+};
+
+static const char *stage_names[STAGES_NUM] = {
+	[STAGE_OUTSIDE] = "outside",
+	[STAGE_FETCH] = "fetch",
+	[STAGE_DECODE] = "decode",
+	[STAGE_EXECUTE] = "execute",
+	[STAGE_OPERAND] = "operand"
+};
+
+// --
+// -- Sampling
+// --
+
+#ifdef ARMEMU_HOST_PERF
+
+// the profile samples are charged to, for the signal handler
+static Host_Perf *profiling;
+
+// Each overflow signals the event's descriptor and stops it until it is
+// refreshed for the next one
+
+static void on_overflow(int signal, siginfo_t *info, void *context) {
+	(void) signal;
+	(void) context;
+	Host_Perf *perf = profiling;
+	if (perf == NULL) {
+		return;
+	}
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		if (perf->fds[event] != info->si_fd) {
+			continue;
+		}
+		perf->samples[event][perf->stage]++;
+		uint32_t pc = perf->arm->pc_reg - PIPELINE_OFFSET;
+		if (perf->stage != STAGE_OUTSIDE && pc < MEMORY_SIZE) {
+			perf->pc_samples[event][pc / 4]++;
+		}
+		ioctl(info->si_fd, PERF_EVENT_IOC_REFRESH, 1);
+	}
+}
+
+static int open_event(const Host_Event *event) {
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = event->type;
+	attr.config = event->config;
+	attr.sample_period = event->period;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.wakeup_events = 1;
+	int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (fd < 0) {
+		return -1;
+	}
+
+	struct f_owner_ex owner = {F_OWNER_TID, syscall(SYS_gettid)};
+	if (fcntl(fd, F_SETFL, O_ASYNC) < 0 || fcntl(fd, F_SETSIG, HOST_PERF_SIGNAL) < 0
+	    || fcntl(fd, F_SETOWN_EX, &owner) < 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+#endif
+
+// --
+// -- Profile lifetime
+// --
+
+Host_Perf *host_perf_create(void) {
+	Host_Perf *perf = calloc(1, sizeof(Host_Perf));
+	if (perf == NULL) {
+		return NULL;
+	}
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		perf->fds[event] = -1;
+	}
+	return perf;
+}
+
+void host_perf_destroy(Host_Perf *perf) {
+	free(perf);
+}
+
+bool host_perf_start(Host_Perf *perf, Machine *arm) {
+#ifdef ARMEMU_HOST_PERF
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = on_overflow;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaction(HOST_PERF_SIGNAL, &action, NULL);
+
+	perf->arm = arm;
+	perf->stage = STAGE_OUTSIDE;
+	profiling = perf;
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		perf->fds[event] = open_event(&host_events[event]);
+		if (perf->fds[event] < 0 && !perf->error) {
+			perf->error = errno;
+		}
+	}
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		if (perf->fds[event] >= 0) {
+			ioctl(perf->fds[event], PERF_EVENT_IOC_RESET, 0);
+			ioctl(perf->fds[event], PERF_EVENT_IOC_REFRESH, 1);
+		}
+	}
+
+	arm->host_perf = perf;
+	perf->first_step = arm->steps;
+	clock_gettime(CLOCK_MONOTONIC, &perf->start);
+	return true;
+#else
+	(void) perf;
+	(void) arm;
+	return false;
+#endif
+}
+
+void host_perf_stop(Host_Perf *perf) {
+#ifdef ARMEMU_HOST_PERF
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		if (perf->fds[event] >= 0) {
+			ioctl(perf->fds[event], PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+	profiling = NULL;
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		if (perf->fds[event] >= 0) {
+			uint64_t count;
+			if (read(perf->fds[event], &count, sizeof(count)) == sizeof(count)) {
+				perf->counts[event] = count;
+			}
+			close(perf->fds[event]);
+		}
+	}
+
+	perf->arm->host_perf = NULL;
+	perf->steps = perf->arm->steps - perf->first_step;
+	perf->wall_ns = (end.tv_sec - perf->start.tv_sec) * 1000000000ull + end.tv_nsec - perf->start.tv_nsec;
+#else
+	(void) perf;
+#endif
+}
+
+// --
+// -- Report
+// --
+
+static bool counted(const Host_Perf *perf, enum host_event event) {
+	return perf->fds[event] >= 0;
+}
+
+// Events estimated from the samples, the total shared out in proportion
+static double estimate(const Host_Perf *perf, enum host_event event, uint64_t samples) {
+	uint64_t all = 0;
+	for (int stage = 0; stage < STAGES_NUM; stage++) {
+		all += perf->samples[event][stage];
+	}
+	return all ? (double) perf->counts[event] * samples / all : 0;
+}
+
+static void print_per_instruction(const Host_Perf *perf, enum host_event event, FILE *out) {
+	if (!counted(perf, event)) {
+		fprintf(out, "%-14s n/a\n", host_events[event].name);
+		return;
+	}
+	fprintf(out, "%-14s %llu (%.2f per emulated instruction)\n", host_events[event].name,
+	        (unsigned long long) perf->counts[event],
+	        perf->steps ? (double) perf->counts[event] / perf->steps : 0);
+}
+
+// The event the host time is best told by
+static enum host_event time_event(const Host_Perf *perf) {
+	return counted(perf, HOST_CYCLES) ? HOST_CYCLES : HOST_TASK_CLOCK;
+}
+
+static void print_stages(const Host_Perf *perf, FILE *out) {
+	enum host_event time = time_event(perf);
+	fprintf(out, "%-8s %8s %8s %14s %14s\n", "stage", time == HOST_CYCLES ? "cycles" : "time", "IPC",
+	        "br-miss/instr", "L1D-miss/instr");
+	for (int stage = STAGE_FETCH; stage < STAGES_NUM; stage++) {
+		uint64_t total = perf->counts[time] ? perf->counts[time] : 1;
+		double share = estimate(perf, time, perf->samples[time][stage]) / total;
+		fprintf(out, "%-8s %7.1f%%", stage_names[stage], 100 * share);
+
+		double cycles = estimate(perf, HOST_CYCLES, perf->samples[HOST_CYCLES][stage]);
+		double instructions = estimate(perf, HOST_INSTRUCTIONS, perf->samples[HOST_INSTRUCTIONS][stage]);
+		if (counted(perf, HOST_CYCLES) && counted(perf, HOST_INSTRUCTIONS) && cycles > 0) {
+			fprintf(out, " %8.2f", instructions / cycles);
+		} else {
+			fprintf(out, " %8s", "n/a");
+		}
+		enum host_event misses[2] = {HOST_BRANCH_MISSES, HOST_L1D_MISSES};
+		for (int i = 0; i < 2; i++) {
+			if (counted(perf, misses[i]) && perf->steps) {
+				fprintf(out, " %14.4f", estimate(perf, misses[i], perf->samples[misses[i]][stage]) / perf->steps);
+			} else {
+				fprintf(out, " %14s", "n/a");
+			}
+		}
+		fprintf(out, "\n");
+	}
+}
+
+struct Host_Block {
+	uint32_t start;
+	uint32_t end;
+	uint64_t samples[HOST_EVENTS_NUM];
+};
+typedef struct Host_Block Host_Block;
+
+static enum host_event sorted_event;
+
+static int by_samples(const void *a, const void *b) {
+	const Host_Block *block_a = a;
+	const Host_Block *block_b = b;
+	if (block_a->samples[sorted_event] != block_b->samples[sorted_event]) {
+		return block_a->samples[sorted_event] < block_b->samples[sorted_event] ? 1 : -1;
+	}
+	return block_a->start < block_b->start ? -1 : 1;
+}
+
+// Blocks start at address 0, at branch targets and after branches and
+// halts, among the instructions decoded during the run
+
+static void print_blocks(const Host_Perf *perf, FILE *out) {
+	Machine *arm = perf->arm;
+	bool *leader = calloc(MEMORY_SIZE / 4, sizeof(bool));
+	Host_Block *blocks = malloc(sizeof(Host_Block) * MEMORY_SIZE / 4);
+	if (leader == NULL || blocks == NULL) {
+		free(leader);
+		free(blocks);
+		return;
+	}
+	leader[0] = true;
+	for (uint32_t i = 0; i < MEMORY_SIZE / 4; i++) {
+		Decoded_Instr *instr = &arm->predecoded[i];
+		if (!instr->exists || (instr->type != BRANCH && instr->type != HALT)) {
+			continue;
+		}
+		if (i + 1 < MEMORY_SIZE / 4) {
+			leader[i + 1] = true;
+		}
+		uint32_t target = i * 4 + PIPELINE_OFFSET + instr->operand.sgn_offset;
+		if (instr->type == BRANCH && target < MEMORY_SIZE) {
+			leader[target / 4] = true;
+		}
+	}
+
+	uint32_t count = 0;
+	Host_Block *block = NULL;
+	for (uint32_t i = 0; i < MEMORY_SIZE / 4; i++) {
+		bool sampled = false;
+		for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+			sampled |= perf->pc_samples[event][i] != 0;
+		}
+		if (!sampled && !arm->predecoded[i].exists) {
+			block = NULL;
+			continue;
+		}
+		if (block == NULL || leader[i]) {
+			block = &blocks[count++];
+			memset(block, 0, sizeof(Host_Block));
+			block->start = i * 4;
+		}
+		block->end = i * 4;
+		for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+			block->samples[event] += perf->pc_samples[event][i];
+		}
+	}
+	sorted_event = time_event(perf);
+	qsort(blocks, count, sizeof(Host_Block), by_samples);
+
+	fprintf(out, "%-21s", "block");
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		if (counted(perf, event)) {
+			fprintf(out, " %14s", host_events[event].name);
+		}
+	}
+	fprintf(out, "\n");
+	for (uint32_t i = 0; i < count && i < HOST_PERF_TOP_BLOCKS && blocks[i].samples[sorted_event]; i++) {
+		fprintf(out, "0x%08x-0x%08x", blocks[i].start, blocks[i].end);
+		for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+			if (counted(perf, event)) {
+				fprintf(out, " %14.0f", estimate(perf, event, blocks[i].samples[event]));
+			}
+		}
+		fprintf(out, "\n");
+	}
+	free(leader);
+	free(blocks);
+}
+
+void print_host_perf_report(const Host_Perf *perf, FILE *out) {
+	fprintf(out, "Host performance:\n");
+	fprintf(out, "emulated:      %llu instructions in %.3f ms", (unsigned long long) perf->steps,
+	        perf->wall_ns / 1e6);
+	if (perf->wall_ns) {
+		fprintf(out, " (%.1f M/s)", perf->steps * 1e3 / perf->wall_ns);
+	}
+	fprintf(out, "\n");
+
+	bool any = false;
+	for (int event = 0; event < HOST_EVENTS_NUM; event++) {
+		any |= counted(perf, event);
+	}
+	if (!any) {
+		fprintf(out, "perf events unavailable: %s\n", strerror(perf->error));
+		return;
+	}
+	if (perf->error) {
+		fprintf(out, "some events unavailable: %s\n", strerror(perf->error));
+	}
+	for (int event = 0; event < HOST_TASK_CLOCK; event++) {
+		print_per_instruction(perf, event, out);
+	}
+	if (counted(perf, HOST_CYCLES) && counted(perf, HOST_INSTRUCTIONS) && perf->counts[HOST_CYCLES]) {
+		fprintf(out, "IPC            %.2f\n",
+		        (double) perf->counts[HOST_INSTRUCTIONS] / perf->counts[HOST_CYCLES]);
+	}
+	if (counted(perf, HOST_TASK_CLOCK) && perf->steps) {
+		fprintf(out, "%-14s %.3f ms (%.2f ns per emulated instruction)\n", "task-clock",
+		        perf->counts[HOST_TASK_CLOCK] / 1e6, (double) perf->counts[HOST_TASK_CLOCK] / perf->steps);
+	}
+	fprintf(out, "Stages:\n");
+	print_stages(perf, out);
+	fprintf(out, "Guest blocks:\n");
+	print_blocks(perf, out);
+}
@@ -0,0 +1,80 @@
+#ifndef ARM11_18_HOST_PERF_H
+#define ARM11_18_HOST_PERF_H
+
+#include <signal.h>
+#include <stdio.h>
+#include <time.h>
+#include "define_structures.h"
+
+// --
+// -- Host hardware counters
+// --
+// Profiles the emulator itself with perf_event_open: host cycles,
+// instructions, branch misses and L1D read misses over the run, and
+// sampled on overflow to charge each sample to the emulator stage running
+// and the guest instruction being emulated. Stages are marked as the
+// pipeline moves through them; the markers are only built in with
+// 'make HOST_PERF=1', which defines ARMEMU_HOST_PERF.
+//
+// Hardware events missing on the host (virtual machines often have no
+// PMU) are left out, samples then coming from the task clock alone. With
+// no perf events at all only the wall time is reported. One profile may
+// run at a time in a process, on the thread that started it.
+
+enum host_stage {
+	STAGE_OUTSIDE,          // not emulating
+	STAGE_FETCH,            // step(): bounds check and decode cache lookup
+	STAGE_DECODE,           // decode() of an instruction not cached yet
+	STAGE_EXECUTE,          // execute() and the fused handlers
+	STAGE_OPERAND,          // decode_offset() and the barrel shifter
+	STAGES_NUM
+};
+
+enum host_event {
+	HOST_CYCLES,
+	HOST_INSTRUCTIONS,
+	HOST_BRANCH_MISSES,
+	HOST_L1D_MISSES,
+	HOST_TASK_CLOCK,        // nanoseconds, a software event
+	HOST_EVENTS_NUM
+};
+
+struct Host_Perf {
+	Machine *arm;
+	volatile sig_atomic_t stage;    // enum host_stage
+	int fds[HOST_EVENTS_NUM];       // -1 for events not counted
+	int error;                      // errno of the first event failing to open
+	uint64_t counts[HOST_EVENTS_NUM];
+	uint64_t samples[HOST_EVENTS_NUM][STAGES_NUM];
+	uint32_t pc_samples[HOST_EVENTS_NUM][MEMORY_SIZE / 4];
+	uint64_t first_step;
+	uint64_t steps;                 // guest instructions profiled
+	struct timespec start;
+	uint64_t wall_ns;
+};
+typedef struct Host_Perf Host_Perf;
+
+// Allocate a profile. Returns NULL if out of memory.
+Host_Perf *host_perf_create(void);
+
+void host_perf_destroy(Host_Perf *perf);
+
+// Attach to 'arm' and start counting. Returns false if the emulator was
+// built without ARMEMU_HOST_PERF; failing to open events is not an error.
+bool host_perf_start(Host_Perf *perf, Machine *arm);
+
+// Stop counting, read the totals and detach.
+void host_perf_stop(Host_Perf *perf);
+
+// Totals per emulated instruction, then the share of each stage and the
+// guest basic blocks the host spent most on
+void print_host_perf_report(const Host_Perf *perf, FILE *out);
+
+#ifdef ARMEMU_HOST_PERF
+#define HOST_STAGE(arm, next) \
+	do { if ((arm)->host_perf) (arm)->host_perf->stage = (next); } while (0)
+#else
+#define HOST_STAGE(arm, next) ((void) 0)
+#endif
+
+#endif //ARM11_18_HOST_PERF_H
@@ -0,0 +1,285 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "serve.h"
+#include "define_structures.h"
+#include "state_dump.h"
+
+// usage: loadgen [--connections=N] [--requests=N] [--depth=N] [--no-fusion]
+//                [--dump] socket file
+//
+// Load generator for 'emulate --serve': each connection sends 'requests'
+// jobs running the image in 'file', keeping up to 'depth' of them sent
+// and not yet answered, and the latency of every job is measured from
+// its send to its reply. Prints the throughput and latency percentiles.
+// --dump writes the state dump of the first reply to stdout, to compare
+// with 'emulate --output=binary'.
+
+#define CONNECTIONS_OPTION "--connections="
+#define REQUESTS_OPTION "--requests="
+#define DEPTH_OPTION "--depth="
+#define NO_FUSION_OPTION "--no-fusion"
+#define DUMP_OPTION "--dump"
+
+struct Client {
+	pthread_t thread;
+	int fd;
+	uint32_t requests;
+	uint32_t depth;
+	const uint8_t *message;         // request then image, 'id' rewritten per send
+	size_t message_size;
+
+	pthread_mutex_t lock;
+	pthread_cond_t answered;
+	uint32_t sent;
+	uint32_t received;
+	uint64_t *sent_ns;              // per id
+	uint64_t *latency_ns;           // per id
+	uint32_t errors;                // replies not SERVE_OK, or lost
+	uint8_t *dump;                  // first reply's, if wanted
+	size_t dump_size;
+};
+typedef struct Client Client;
+
+static uint64_t now_ns(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static bool read_all(int fd, void *buffer, size_t length) {
+	uint8_t *next = buffer;
+	while (length) {
+		ssize_t n = read(fd, next, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		next += n;
+		length -= n;
+	}
+	return true;
+}
+
+static bool write_all(int fd, const void *buffer, size_t length) {
+	const uint8_t *next = buffer;
+	while (length) {
+		ssize_t n = write(fd, next, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		next += n;
+		length -= n;
+	}
+	return true;
+}
+
+static uint64_t parse_count(const char *arg, const char *option) {
+	char *end;
+	uint64_t val = strtoull(arg + strlen(option), &end, 10);
+	if (*end != '\0' || end == arg + strlen(option) || val == 0) {
+		fprintf(stderr,"Invalid value for %s",option);
+		exit(EXIT_FAILURE);
+	}
+	return val;
+}
+
+// --
+// -- Connections
+// --
+// Requests are sent from their own thread, so a daemon pushing back on a
+// connection cannot stop its replies being read.
+
+static void *send_requests(void *arg) {
+	Client *client = arg;
+	uint8_t *message = malloc(client->message_size);
+	memcpy(message, client->message, client->message_size);
+
+	for (uint32_t id = 0; id < client->requests; id++) {
+		pthread_mutex_lock(&client->lock);
+		while (client->sent - client->received == client->depth) {
+			pthread_cond_wait(&client->answered, &client->lock);
+		}
+		client->sent_ns[id] = now_ns();
+		client->sent++;
+		pthread_mutex_unlock(&client->lock);
+
+		memcpy(message + offsetof(Serve_Request, id), &id, sizeof(uint32_t));
+		if (!write_all(client->fd, message, client->message_size)) {
+			break;
+		}
+	}
+	free(message);
+	return NULL;
+}
+
+static void *run_client(void *arg) {
+	Client *client = arg;
+	pthread_t sender;
+	pthread_create(&sender, NULL, send_requests, client);
+
+	uint8_t *payload = malloc(DUMP_MAX_SIZE);
+	uint32_t received = 0;
+	while (received < client->requests) {
+		Serve_Reply reply;
+		if (!read_all(client->fd, &reply, sizeof(Serve_Reply)) || reply.magic != SERVE_REPLY_MAGIC
+		    || reply.length > DUMP_MAX_SIZE || reply.id >= client->requests
+		    || !read_all(client->fd, payload, reply.length)) {
+			break;
+		}
+		uint64_t done = now_ns();
+		if (reply.status != SERVE_OK) {
+			client->errors++;
+		}
+		if (client->dump != NULL && client->dump_size == 0) {
+			memcpy(client->dump, payload, reply.length);
+			client->dump_size = reply.length;
+		}
+		received++;
+
+		pthread_mutex_lock(&client->lock);
+		client->latency_ns[reply.id] = done - client->sent_ns[reply.id];
+		client->received = received;
+		pthread_cond_signal(&client->answered);
+		pthread_mutex_unlock(&client->lock);
+	}
+	client->errors += client->requests - received;
+
+	shutdown(client->fd, SHUT_RDWR);        // <- unblocks the sender if the daemon is gone
+	pthread_join(sender, NULL);
+	free(payload);
+	return NULL;
+}
+
+static int connect_to(const char *path) {
+	struct sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0 || connect(fd, (struct sockaddr *) &address, sizeof(address))) {
+		fprintf(stderr,"Could not connect to %s: %s",path,strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+	return fd;
+}
+
+// --
+// -- Report
+// --
+
+static int compare_ns(const void *a, const void *b) {
+	uint64_t x = *(const uint64_t *) a;
+	uint64_t y = *(const uint64_t *) b;
+	return (x > y) - (x < y);
+}
+
+static double percentile_us(const uint64_t *sorted, uint64_t count, double p) {
+	uint64_t i = (uint64_t) (p * (count - 1) + 0.5);
+	return sorted[i] / 1000.0;
+}
+
+int main(int argc, char **argv) {
+	uint32_t connections = 1;
+	uint32_t requests = 1000;
+	uint32_t depth = 1;
+	uint32_t flags = 0;
+	bool dump = false;
+	const char *path = NULL;
+	const char *filename = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strncmp(argv[i], CONNECTIONS_OPTION, strlen(CONNECTIONS_OPTION))) {
+			connections = parse_count(argv[i], CONNECTIONS_OPTION);
+		} else if (!strncmp(argv[i], REQUESTS_OPTION, strlen(REQUESTS_OPTION))) {
+			requests = parse_count(argv[i], REQUESTS_OPTION);
+		} else if (!strncmp(argv[i], DEPTH_OPTION, strlen(DEPTH_OPTION))) {
+			depth = parse_count(argv[i], DEPTH_OPTION);
+		} else if (!strcmp(argv[i], NO_FUSION_OPTION)) {
+			flags |= SERVE_NO_FUSION;
+		} else if (!strcmp(argv[i], DUMP_OPTION)) {
+			dump = true;
+		} else if (path == NULL) {
+			path = argv[i];
+		} else if (filename == NULL) {
+			filename = argv[i];
+		} else {
+			filename = NULL;
+			break;
+		}
+	}
+	if (filename == NULL) {
+		fprintf(stderr,"Invalid argument number");
+		exit(EXIT_FAILURE);
+	}
+
+	// one message, the request header then the image, sent over and over
+
+	FILE *input = fopen(filename, "rb");
+	if (input == NULL) {
+		fprintf(stderr,"File could not be found");
+		exit(EXIT_FAILURE);
+	}
+	uint8_t *message = malloc(sizeof(Serve_Request) + MEMORY_SIZE);
+	size_t image_size = fread(message + sizeof(Serve_Request), 1, MEMORY_SIZE, input);
+	fclose(input);
+	Serve_Request request = {SERVE_REQUEST_MAGIC, 0, flags, image_size, 0, 0};
+	memcpy(message, &request, sizeof(Serve_Request));
+
+	Client *clients = calloc(connections, sizeof(Client));
+	uint64_t start = now_ns();
+	for (uint32_t c = 0; c < connections; c++) {
+		Client *client = &clients[c];
+		client->fd = connect_to(path);
+		client->requests = requests;
+		client->depth = depth;
+		client->message = message;
+		client->message_size = sizeof(Serve_Request) + image_size;
+		pthread_mutex_init(&client->lock, NULL);
+		pthread_cond_init(&client->answered, NULL);
+		client->sent_ns = calloc(requests, sizeof(uint64_t));
+		client->latency_ns = calloc(requests, sizeof(uint64_t));
+		client->dump = dump && c == 0 ? malloc(DUMP_MAX_SIZE) : NULL;
+		pthread_create(&client->thread, NULL, run_client, client);
+	}
+
+	uint64_t total = (uint64_t) connections * requests;
+	uint64_t *latencies = malloc(total * sizeof(uint64_t));
+	uint32_t errors = 0;
+	for (uint32_t c = 0; c < connections; c++) {
+		pthread_join(clients[c].thread, NULL);
+		memcpy(&latencies[(uint64_t) c * requests], clients[c].latency_ns, requests * sizeof(uint64_t));
+		errors += clients[c].errors;
+		close(clients[c].fd);
+	}
+	double seconds = (now_ns() - start) / 1e9;
+
+	if (dump) {
+		fwrite(clients[0].dump, 1, clients[0].dump_size, stdout);
+	}
+	qsort(latencies, total, sizeof(uint64_t), compare_ns);
+	fprintf(stderr,"%llu requests over %u connections, depth %u: %.3f s, %.0f requests/s\n",
+	        (unsigned long long) total, connections, depth, seconds, total / seconds);
+	fprintf(stderr,"latency us: p50 %.1f  p99 %.1f  max %.1f\n",
+	        percentile_us(latencies, total, 0.5), percentile_us(latencies, total, 0.99),
+	        latencies[total - 1] / 1000.0);
+	if (errors) {
+		fprintf(stderr,"%u requests failed or were not answered\n",errors);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
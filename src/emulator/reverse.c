@@ -0,0 +1,406 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "reverse.h"
+#include "armemu.h"
+#include "emulator_processor.h"
+
+#define PAGES_NUM (MEMORY_SIZE >> REVERSE_PAGE_SHIFT)
+#define ALL_PAGES (PAGES_NUM == 64 ? ~0ull : (1ull << PAGES_NUM) - 1)
+
+static bool set_reverse(Machine *arm, Reverse *reverse) {
+#ifdef ARMEMU_REVERSE
+	arm->reverse = reverse;
+	return true;
+#else
+	(void) arm;
+	(void) reverse;
+	return false;
+#endif
+}
+
+static void save_registers(const Machine *arm, Reverse_Registers *registers) {
+	memcpy(registers->general_reg, arm->general_reg, sizeof(registers->general_reg));
+	registers->cpsr_reg = arm->cpsr_reg;
+	registers->pc_reg = arm->pc_reg;
+	registers->stack_limit = arm->stack_limit;
+	registers->steps = arm->steps;
+	registers->end = arm->end;
+	registers->fault = arm->fault;
+	registers->fault_addr = arm->fault_addr;
+}
+
+static void restore_registers(Machine *arm, const Reverse_Registers *registers) {
+	memcpy(arm->general_reg, registers->general_reg, sizeof(registers->general_reg));
+	arm->cpsr_reg = registers->cpsr_reg;
+	arm->pc_reg = registers->pc_reg;
+	arm->stack_limit = registers->stack_limit;
+	arm->steps = registers->steps;
+	arm->end = registers->end;
+	arm->fault = registers->fault;
+	arm->fault_addr = registers->fault_addr;
+	arm->branch_executed = false;
+	arm->shifter_carry = 0;
+}
+
+static size_t checkpoint_bytes(uint64_t saved) {
+	return sizeof(Checkpoint) + (size_t) __builtin_popcountll(saved) * REVERSE_PAGE_SIZE;
+}
+
+// --
+// -- Checkpoints
+// --
+
+// Checkpoint the machine, keeping the pages in 'saved'. The first
+// checkpoint's pages are allocated with the history.
+static bool add_checkpoint(Reverse *reverse, uint64_t saved) {
+	Machine *arm = reverse->arm;
+	if (reverse->count == reverse->capacity) {
+		uint32_t capacity = reverse->capacity ? 2 * reverse->capacity : 256;
+		Checkpoint *checkpoints = realloc(reverse->checkpoints, capacity * sizeof(Checkpoint));
+		if (checkpoints == NULL) {
+			return false;
+		}
+		reverse->checkpoints = checkpoints;
+		reverse->capacity = capacity;
+	}
+	Checkpoint *checkpoint = &reverse->checkpoints[reverse->count];
+	if (reverse->count > 0) {
+		checkpoint->pages = NULL;
+	}
+	if (saved && checkpoint->pages == NULL) {
+		checkpoint->pages = malloc(__builtin_popcountll(saved) * REVERSE_PAGE_SIZE);
+		if (checkpoint->pages == NULL) {
+			return false;
+		}
+	}
+	uint8_t *copy = checkpoint->pages;
+	for (uint64_t pages = saved; pages; pages &= pages - 1, copy += REVERSE_PAGE_SIZE) {
+		memcpy(copy, &arm->memory[__builtin_ctzll(pages) << REVERSE_PAGE_SHIFT], REVERSE_PAGE_SIZE);
+	}
+	checkpoint->saved = saved;
+	save_registers(arm, &checkpoint->registers);
+
+	reverse->bytes += checkpoint_bytes(saved);
+	reverse->base = reverse->count++;
+	reverse->dirty = 0;
+	return true;
+}
+
+// Page 'page' as it was at checkpoint 'index'
+static const uint8_t *page_at(const Reverse *reverse, uint32_t index, uint32_t page) {
+	uint64_t bit = 1ull << page;
+	while (!(reverse->checkpoints[index].saved & bit)) {
+		index--;        // <- the first checkpoint has every page
+	}
+	const Checkpoint *checkpoint = &reverse->checkpoints[index];
+	return &checkpoint->pages[__builtin_popcountll(checkpoint->saved & (bit - 1)) << REVERSE_PAGE_SHIFT];
+}
+
+// Fold checkpoint 'index' into the next one: the pages it kept that the
+// next did not are the same at both
+static void merge_checkpoint(Reverse *reverse, uint32_t index) {
+	Checkpoint *from = &reverse->checkpoints[index];
+	Checkpoint *into = &reverse->checkpoints[index + 1];
+	uint64_t saved = from->saved | into->saved;
+	reverse->bytes -= checkpoint_bytes(from->saved) + checkpoint_bytes(into->saved);
+
+	if (saved != into->saved) {
+		uint8_t *pages = malloc(__builtin_popcountll(saved) * REVERSE_PAGE_SIZE);
+		if (pages == NULL) {
+			reverse->bytes += checkpoint_bytes(from->saved) + checkpoint_bytes(into->saved);
+			return;
+		}
+		uint8_t *copy = pages;
+		for (uint64_t left = saved; left; left &= left - 1, copy += REVERSE_PAGE_SIZE) {
+			uint64_t bit = left & -left;
+			const Checkpoint *source = into->saved & bit ? into : from;
+			memcpy(copy, &source->pages[__builtin_popcountll(source->saved & (bit - 1)) << REVERSE_PAGE_SHIFT],
+			       REVERSE_PAGE_SIZE);
+		}
+		free(into->pages);
+		into->pages = pages;
+		into->saved = saved;
+	}
+	free(from->pages);
+	from->pages = NULL;
+	reverse->bytes += checkpoint_bytes(into->saved);
+}
+
+// Halve the checkpoints until they fit the budget, keeping the first and
+// the last. Only called with the machine at the last.
+static void thin(Reverse *reverse) {
+	while (reverse->bytes > reverse->config.budget && reverse->count > 2) {
+		uint32_t kept = 1;
+		for (uint32_t i = 1; i < reverse->count; i++) {
+			if (i % 2 == 1 && i != reverse->count - 1) {
+				merge_checkpoint(reverse, i);
+				continue;
+			}
+			reverse->checkpoints[kept++] = reverse->checkpoints[i];
+		}
+		reverse->count = kept;
+		reverse->base = kept - 1;
+		reverse->interval *= 2;
+	}
+}
+
+// Last checkpoint at or before 'step'
+static uint32_t checkpoint_before(const Reverse *reverse, uint64_t step) {
+	uint32_t low = 0;
+	uint32_t high = reverse->count - 1;
+	while (low < high) {
+		uint32_t middle = (low + high + 1) / 2;
+		if (reverse->checkpoints[middle].registers.steps <= step) {
+			low = middle;
+		} else {
+			high = middle - 1;
+		}
+	}
+	return low;
+}
+
+// Put the machine back to checkpoint 'index'. The pages that may differ
+// are the ones stored to since the base, and the ones kept by the
+// checkpoints between the base and 'index'.
+static void restore(Reverse *reverse, uint32_t index) {
+	uint32_t low = index < reverse->base ? index : reverse->base;
+	uint32_t high = index < reverse->base ? reverse->base : index;
+	uint64_t changed = reverse->dirty;
+	for (uint32_t i = low + 1; i <= high; i++) {
+		changed |= reverse->checkpoints[i].saved;
+	}
+	for (; changed; changed &= changed - 1) {
+		uint32_t page = __builtin_ctzll(changed);
+		write_memory(reverse->arm, page << REVERSE_PAGE_SHIFT, page_at(reverse, index, page), REVERSE_PAGE_SIZE);
+	}
+	restore_registers(reverse->arm, &reverse->checkpoints[index].registers);
+	reverse->base = index;
+	reverse->dirty = 0;
+}
+
+// --
+// -- Lifetime
+// --
+
+Reverse *reverse_create(const Reverse_Config *config) {
+	Reverse *reverse = calloc(1, sizeof(Reverse));
+	if (reverse == NULL) {
+		return NULL;
+	}
+	reverse->capacity = 256;
+	reverse->checkpoints = calloc(reverse->capacity, sizeof(Checkpoint));
+	if (reverse->checkpoints != NULL) {
+		reverse->checkpoints[0].pages = malloc(MEMORY_SIZE);
+	}
+	if (reverse->checkpoints == NULL || reverse->checkpoints[0].pages == NULL) {
+		reverse_destroy(reverse);
+		return NULL;
+	}
+	reverse->config = *config;
+	if (reverse->config.budget < REVERSE_MIN_BUDGET) {
+		reverse->config.budget = REVERSE_MIN_BUDGET;
+	}
+	reverse->interval = config->interval ? config->interval : REVERSE_DEFAULT_INTERVAL;
+	reverse->watch = REVERSE_NO_WATCH;
+	return reverse;
+}
+
+bool reverse_attach(Reverse *reverse, Machine *arm) {
+	if (!set_reverse(arm, reverse)) {
+		return false;
+	}
+	reverse->arm = arm;
+	add_checkpoint(reverse, ALL_PAGES);
+	return true;
+}
+
+void reverse_destroy(Reverse *reverse) {
+	if (reverse->arm != NULL) {
+		set_reverse(reverse->arm, NULL);
+	}
+	if (reverse->checkpoints != NULL) {
+		free(reverse->checkpoints[0].pages);
+		for (uint32_t i = 1; i < reverse->count; i++) {
+			free(reverse->checkpoints[i].pages);
+		}
+	}
+	free(reverse->checkpoints);
+	free(reverse);
+}
+
+bool reverse_break(Reverse *reverse, uint32_t address, bool set) {
+	for (uint32_t i = 0; i < reverse->breakpoint_count; i++) {
+		if (reverse->breakpoints[i] == address) {
+			if (!set) {
+				reverse->breakpoints[i] = reverse->breakpoints[--reverse->breakpoint_count];
+			}
+			return true;
+		}
+	}
+	if (!set || reverse->breakpoint_count == REVERSE_MAX_BREAKPOINTS) {
+		return false;
+	}
+	reverse->breakpoints[reverse->breakpoint_count++] = address;
+	return true;
+}
+
+void reverse_watch(Reverse *reverse, int reg) {
+	reverse->watch = reg;
+}
+
+void reverse_interrupt(Reverse *reverse) {
+	reverse->interrupted = 1;
+}
+
+// --
+// -- Running
+// --
+
+static bool at_breakpoint(const Reverse *reverse) {
+	uint32_t address = reverse->arm->pc_reg - PIPELINE_OFFSET;
+	for (uint32_t i = 0; i < reverse->breakpoint_count; i++) {
+		if (reverse->breakpoints[i] == address) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool has_stops(const Reverse *reverse) {
+	return reverse->breakpoint_count || reverse->watch != REVERSE_NO_WATCH;
+}
+
+// One instruction at a time, until a stop or 'count' instructions
+static enum reverse_stop step_checked(Reverse *reverse, uint64_t count) {
+	Machine *arm = reverse->arm;
+	for (uint64_t i = 0; i < count; i++) {
+		uint32_t watched = reverse->watch != REVERSE_NO_WATCH ? arm->general_reg[reverse->watch] : 0;
+		if (!armemu_step(arm, 1)) {
+			return REVERSE_HALTED;
+		}
+		if (reverse->watch != REVERSE_NO_WATCH && arm->general_reg[reverse->watch] != watched) {
+			return REVERSE_WATCH;
+		}
+		if (at_breakpoint(reverse)) {
+			return REVERSE_BREAKPOINT;
+		}
+		if (reverse->interrupted) {
+			return REVERSE_INTERRUPTED;
+		}
+	}
+	return REVERSE_STEPPED;
+}
+
+// Run to step 'target' a checkpoint interval at a time, checkpointing the
+// steps past the last checkpoint and passing through the others, where
+// the machine is as they saved it.
+static enum reverse_stop run_to(Reverse *reverse, uint64_t target, bool stops) {
+	Machine *arm = reverse->arm;
+	bool until_stopped = target == UINT64_MAX;
+	reverse->interrupted = 0;
+	while (arm->steps < target) {
+		if (arm->end) {
+			return REVERSE_HALTED;
+		}
+		if (reverse->interrupted) {
+			return REVERSE_INTERRUPTED;
+		}
+		uint32_t next = reverse->base + 1;
+		uint64_t boundary = next < reverse->count ? reverse->checkpoints[next].registers.steps
+		                    : reverse->checkpoints[reverse->base].registers.steps + reverse->interval;
+		uint64_t chunk = (target < boundary ? target : boundary) - arm->steps;
+
+		enum reverse_stop stop = REVERSE_STEPPED;
+		if (stops) {
+			stop = step_checked(reverse, chunk);
+		} else {
+			armemu_step(arm, chunk);
+		}
+		if (arm->steps == boundary) {
+			if (next < reverse->count) {
+				reverse->base = next;
+				reverse->dirty = 0;
+			} else if (add_checkpoint(reverse, reverse->dirty)) {
+				thin(reverse);
+			}
+		}
+		if (stop != REVERSE_STEPPED) {
+			return stop;
+		}
+		if (until_stopped && arm->fault == ARMEMU_SPIN) {
+			return REVERSE_SPIN;
+		}
+	}
+	return arm->end && until_stopped ? REVERSE_HALTED : REVERSE_STEPPED;
+}
+
+enum reverse_stop reverse_forward(Reverse *reverse, uint64_t count) {
+	uint64_t steps = reverse->arm->steps;
+	uint64_t target = count > UINT64_MAX - steps ? UINT64_MAX : steps + count;
+	if (reverse->arm->end) {
+		return REVERSE_HALTED;
+	}
+	return run_to(reverse, target, has_stops(reverse));
+}
+
+// From the checkpoint before 'step', unless the machine is closer
+
+enum reverse_stop reverse_goto(Reverse *reverse, uint64_t step) {
+	uint32_t index = checkpoint_before(reverse, step);
+	if (step < reverse->arm->steps || reverse->checkpoints[index].registers.steps > reverse->arm->steps) {
+		restore(reverse, index);
+	}
+	enum reverse_stop stop = run_to(reverse, step, false);
+	return stop == REVERSE_STEPPED && step == 0 ? REVERSE_START : stop;
+}
+
+enum reverse_stop reverse_back(Reverse *reverse, uint64_t count) {
+	uint64_t steps = reverse->arm->steps;
+	return reverse_goto(reverse, count < steps ? steps - count : 0);
+}
+
+// The intervals before the current step are run again one instruction at
+// a time, latest first, until one holds a stop. A change of the watched
+// register shows at the step after the instruction making it.
+
+enum reverse_stop reverse_continue_back(Reverse *reverse) {
+	Machine *arm = reverse->arm;
+	uint64_t current = arm->steps;
+	uint64_t limit = current ? current - 1 : 0;     // latest step left to look at
+	reverse->interrupted = 0;
+	while (limit > 0 && has_stops(reverse)) {
+		uint32_t index = checkpoint_before(reverse, limit - 1);
+		restore(reverse, index);
+
+		uint64_t found = 0;
+		enum reverse_stop stop = REVERSE_START;
+		while (arm->steps < limit) {
+			uint32_t watched = reverse->watch != REVERSE_NO_WATCH ? arm->general_reg[reverse->watch] : 0;
+			armemu_step(arm, 1);
+			if (reverse->watch != REVERSE_NO_WATCH && arm->general_reg[reverse->watch] != watched) {
+				found = arm->steps;
+				stop = REVERSE_WATCH;
+			} else if (at_breakpoint(reverse)) {
+				found = arm->steps;
+				stop = REVERSE_BREAKPOINT;
+			}
+			if (reverse->interrupted) {
+				reverse_goto(reverse, current);
+				return REVERSE_INTERRUPTED;
+			}
+		}
+		if (stop != REVERSE_START) {
+			reverse_goto(reverse, found);
+			return stop;
+		}
+		limit = reverse->checkpoints[index].registers.steps;
+	}
+	reverse_goto(reverse, 0);
+	return at_breakpoint(reverse) ? REVERSE_BREAKPOINT : REVERSE_START;
+}
+
+void print_reverse_stats(const Reverse *reverse, FILE *out) {
+	fprintf(out, "%u checkpoints, %zu KB, every %llu instructions\n", reverse->count,
+	        reverse->bytes >> 10, (unsigned long long) reverse->interval);
+}
@@ -0,0 +1,142 @@
+#ifndef ARM11_18_REVERSE_H
+#define ARM11_18_REVERSE_H
+
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "define_structures.h"
+
+// --
+// -- Reverse execution
+// --
+// The machine is checkpointed every 'interval' instructions as it runs
+// forward: its registers, and the memory pages stored to since the last
+// checkpoint, found through the dirty bits invalidate_stored() sets.
+// Going back to an earlier step restores the last checkpoint before it,
+// writing back only the pages changed since, and runs forward from there.
+// Runs being deterministic, this gives the state the machine had then,
+// as long as no devices are mapped.
+//
+// When the pages kept outgrow the budget, every other checkpoint is
+// merged into the next one and the interval doubled, so going back costs
+// at most one interval of re-execution however long the run.
+//
+// Runs forward stop at breakpoints, before the instruction at their
+// address, and when a watched register has just changed; runs backward
+// stop at the last such step before the current one.
+//
+// The hooks are only built in with 'make REVERSE=1', which defines
+// ARMEMU_REVERSE.
+
+#define REVERSE_PAGE_SHIFT 10                   // 64 pages, one bit each in a mask
+#define REVERSE_PAGE_SIZE (1 << REVERSE_PAGE_SHIFT)
+#define REVERSE_DEFAULT_INTERVAL 100000
+#define REVERSE_DEFAULT_BUDGET (64 << 20)       // bytes
+#define REVERSE_MIN_BUDGET (1 << 20)
+#define REVERSE_MAX_BREAKPOINTS 64
+#define REVERSE_NO_WATCH (-1)
+
+struct Reverse_Config {
+	uint64_t interval;      // instructions between checkpoints, at first
+	size_t budget;          // bytes of checkpoints kept, at least REVERSE_MIN_BUDGET
+};
+typedef struct Reverse_Config Reverse_Config;
+
+enum reverse_stop {
+	REVERSE_STEPPED,        // went as far as asked
+	REVERSE_BREAKPOINT,
+	REVERSE_WATCH,
+	REVERSE_HALTED,         // halted or faulted, nothing left to run
+	REVERSE_SPIN,           // branch to itself, would run forever
+	REVERSE_START,          // back at the first step
+	REVERSE_INTERRUPTED     // reverse_interrupt() was called
+};
+
+// Machine state outside guest memory
+struct Reverse_Registers {
+	uint32_t general_reg[GENERAL_REGISTERS_NUM];
+	uint32_t cpsr_reg;
+	uint32_t pc_reg;
+	uint32_t stack_limit;
+	uint64_t steps;
+	bool end;
+	enum armemu_fault fault;
+	uint32_t fault_addr;
+};
+typedef struct Reverse_Registers Reverse_Registers;
+
+// 'pages' holds a copy of each page set in 'saved', in page order. The
+// first checkpoint saves them all.
+struct Checkpoint {
+	Reverse_Registers registers;
+	uint64_t saved;
+	uint8_t *pages;
+};
+typedef struct Checkpoint Checkpoint;
+
+struct Reverse {
+	Reverse_Config config;
+	Machine *arm;
+	uint64_t interval;
+
+	Checkpoint *checkpoints;        // by step
+	uint32_t count;
+	uint32_t capacity;
+	size_t bytes;                   // of pages kept
+
+	// the machine is the checkpoint 'base' with the pages in 'dirty'
+	// stored to since
+	uint32_t base;
+	uint64_t dirty;
+
+	uint32_t breakpoints[REVERSE_MAX_BREAKPOINTS];
+	uint32_t breakpoint_count;
+	int watch;                      // register, or REVERSE_NO_WATCH
+	volatile sig_atomic_t interrupted;
+};
+typedef struct Reverse Reverse;
+
+// Returns NULL if out of memory
+Reverse *reverse_create(const Reverse_Config *config);
+
+// Record the history of 'arm' from its current state, the first step.
+// Returns false if the emulator was built without ARMEMU_REVERSE.
+bool reverse_attach(Reverse *reverse, Machine *arm);
+
+void reverse_destroy(Reverse *reverse);
+
+// Run up to 'count' instructions forward, UINT64_MAX meaning until
+// stopped, checkpointing the steps not run before.
+enum reverse_stop reverse_forward(Reverse *reverse, uint64_t count);
+
+// Go back 'count' instructions, or to the first step.
+enum reverse_stop reverse_back(Reverse *reverse, uint64_t count);
+
+// Go back to the last breakpoint or watched change before this step.
+enum reverse_stop reverse_continue_back(Reverse *reverse);
+
+// Go to step 'step', before or after this one.
+enum reverse_stop reverse_goto(Reverse *reverse, uint64_t step);
+
+// Returns false if the breakpoint table is full, or when deleting, if
+// there is no breakpoint at 'address'.
+bool reverse_break(Reverse *reverse, uint32_t address, bool set);
+
+// Stop when 'reg' changes, REVERSE_NO_WATCH to stop watching
+void reverse_watch(Reverse *reverse, int reg);
+
+// Make the run in progress stop at the next instruction; safe from a
+// signal handler
+void reverse_interrupt(Reverse *reverse);
+
+// Checkpoints kept, their bytes and the current interval
+void print_reverse_stats(const Reverse *reverse, FILE *out);
+
+#ifdef ARMEMU_REVERSE
+#define REVERSE_DIRTY(arm, address) \
+	do { if ((arm)->reverse) (arm)->reverse->dirty |= 1ull << ((address) >> REVERSE_PAGE_SHIFT); } while (0)
+#else
+#define REVERSE_DIRTY(arm, address) ((void) 0)
+#endif
+
+#endif //ARM11_18_REVERSE_H
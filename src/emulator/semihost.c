@@ -0,0 +1,93 @@
+#include <string.h>
+
+#include "semihost.h"
+#include "emulator_processor.h"
+
+#define ADLER_MOD 65521
+#define ADLER_BLOCK 5552        // longest run the sums below hold without reducing
+
+static bool in_memory(uint32_t address, uint32_t length) {
+	return length <= MEMORY_SIZE && address <= MEMORY_SIZE - length;
+}
+
+// Adler-32 a block at a time: within one, the second sum grows by the
+// first times the block length plus each byte weighted by its distance
+// from the end, two plain reductions the compiler can vectorise.
+static uint32_t adler32(const uint8_t *data, uint32_t length) {
+	uint32_t a = 1;
+	uint32_t b = 0;
+	while (length) {
+		uint32_t block = length < ADLER_BLOCK ? length : ADLER_BLOCK;
+		uint32_t sum = 0;
+		uint32_t weighted = 0;
+		for (uint32_t i = 0; i < block; i++) {
+			sum += data[i];
+			weighted += (block - i) * data[i];
+		}
+		b = (b + (uint64_t) block * a + weighted) % ADLER_MOD;
+		a = (a + sum) % ADLER_MOD;
+		data += block;
+		length -= block;
+	}
+	return b << 16 | a;
+}
+
+int64_t semihost_call(uint32_t call, uint8_t *memory, uint32_t *reg, uint32_t *bad_address) {
+	uint32_t first = reg[0];
+	uint32_t second = reg[1];
+	uint32_t length = reg[2];
+	int result;
+
+	switch (call) {
+	case SEMIHOST_MEMCPY:
+		if (!in_memory(second, length)) {
+			*bad_address = second;
+			return -1;
+		}
+		if (!in_memory(first, length)) {
+			*bad_address = first;
+			return -1;
+		}
+		memmove(&memory[first], &memory[second], length);
+		return length;
+	case SEMIHOST_MEMSET:
+		if (!in_memory(first, length)) {
+			*bad_address = first;
+			return -1;
+		}
+		memset(&memory[first], (uint8_t) second, length);
+		return length;
+	case SEMIHOST_MEMCMP:
+		if (!in_memory(first, length)) {
+			*bad_address = first;
+			return -1;
+		}
+		if (!in_memory(second, length)) {
+			*bad_address = second;
+			return -1;
+		}
+		result = memcmp(&memory[first], &memory[second], length);
+		reg[0] = result < 0 ? -1 : result > 0;
+		return 0;
+	case SEMIHOST_CHECKSUM:
+		if (!in_memory(first, second)) {
+			*bad_address = first;
+			return -1;
+		}
+		reg[0] = adler32(&memory[first], second);
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+void semihost(Decoded_Instr *instr, Machine *arm) {
+	uint32_t bad_address;
+	uint32_t destination = arm->general_reg[0];
+	int64_t written = semihost_call(instr->operand.call, arm->memory, arm->general_reg, &bad_address);
+	if (written < 0) {
+		out_of_bounds(arm, bad_address);
+		return;
+	}
+	invalidate_stored(arm, destination, written);
+}
@@ -0,0 +1,31 @@
+#ifndef ARM11_18_SEMIHOST_H
+#define ARM11_18_SEMIHOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "define_structures.h"
+
+// --
+// -- Semihosting
+// --
+// swi #call hands a bulk memory operation to the emulator, which runs it
+// on guest memory with the host's library routines as one instruction.
+// Arguments are taken from r0-r2 and results returned in r0; the other
+// registers and the flags are left alone. A range reaching outside guest
+// memory is recorded as ARMEMU_OUT_OF_BOUNDS and the call skipped, as a
+// single transfer would be. Unknown calls do nothing.
+
+enum semihost_call {
+	SEMIHOST_MEMCPY = 1,    // r0 destination, r1 source, r2 bytes; ranges may overlap
+	SEMIHOST_MEMSET = 2,    // r0 destination, r1 byte value, r2 bytes
+	SEMIHOST_MEMCMP = 3,    // r0, r1 ranges, r2 bytes; r0 = -1, 0 or 1
+	SEMIHOST_CHECKSUM = 4   // r0 address, r1 bytes; r0 = Adler-32 of the range
+};
+
+// Run 'call' on 'memory' with 'reg' holding r0-r2. Returns the bytes
+// written from reg[0] on, or -1 with 'bad_address' set if a range does not fit.
+int64_t semihost_call(uint32_t call, uint8_t *memory, uint32_t *reg, uint32_t *bad_address);
+
+void semihost(Decoded_Instr *instr, Machine *arm);
+
+#endif //ARM11_18_SEMIHOST_H
@@ -0,0 +1,431 @@
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "serve.h"
+#include "armemu.h"
+#include "define_structures.h"
+#include "state_dump.h"
+
+// machines per worker, so most jobs find the one that last ran their image
+#define MACHINES_PER_THREAD 2
+#define LISTEN_BACKLOG 64
+
+typedef struct Server Server;
+
+struct Connection {
+	Server *server;
+	int fd;
+	pthread_mutex_t lock;           // held while writing a reply, which goes whole
+	pthread_cond_t answered;
+	uint32_t inflight;              // jobs queued or running
+	bool closed;                    // no more requests, freed with the last reply
+	bool broken;                    // a reply failed to send
+};
+typedef struct Connection Connection;
+
+struct Job {
+	Connection *conn;
+	Serve_Request request;
+	uint8_t image[];
+};
+typedef struct Job Job;
+
+struct Pool_Machine {
+	Machine *arm;
+	uint64_t image_hash;            // of the image it last ran
+	uint64_t last_used;
+	bool busy;
+};
+typedef struct Pool_Machine Pool_Machine;
+
+struct Server {
+	const Serve_Config *config;
+
+	// guards both the job queue and the machine pool
+	pthread_mutex_t lock;
+	pthread_cond_t queued;
+	pthread_cond_t dequeued;
+	Job *queue[SERVE_QUEUE_SIZE];
+	uint32_t head;
+	uint32_t count;
+
+	Pool_Machine *machines;
+	uint32_t machines_num;
+	uint64_t clock;
+};
+
+static volatile sig_atomic_t stopping = 0;
+
+static void stop(int signal) {
+	(void) signal;
+	stopping = 1;
+}
+
+// --
+// -- Socket I/O
+// --
+
+static bool read_all(int fd, void *buffer, size_t length) {
+	uint8_t *next = buffer;
+	while (length) {
+		ssize_t n = read(fd, next, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		next += n;
+		length -= n;
+	}
+	return true;
+}
+
+static bool write_all(int fd, const void *buffer, size_t length) {
+	const uint8_t *next = buffer;
+	while (length) {
+		ssize_t n = write(fd, next, length);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return false;
+		}
+		next += n;
+		length -= n;
+	}
+	return true;
+}
+
+static void send_reply(Connection *conn, const void *reply, size_t length) {
+	if (!conn->broken && !write_all(conn->fd, reply, length)) {
+		conn->broken = true;
+		shutdown(conn->fd, SHUT_RDWR);    // <- wakes the reader up
+	}
+}
+
+static void free_connection(Connection *conn) {
+	close(conn->fd);
+	pthread_mutex_destroy(&conn->lock);
+	pthread_cond_destroy(&conn->answered);
+	free(conn);
+}
+
+// --
+// -- Job queue
+// --
+// Full queues block the connection readers, which then leave their
+// requests in the socket.
+
+static void push_job(Server *server, Job *job) {
+	pthread_mutex_lock(&server->lock);
+	while (server->count == SERVE_QUEUE_SIZE) {
+		pthread_cond_wait(&server->dequeued, &server->lock);
+	}
+	server->queue[(server->head + server->count) % SERVE_QUEUE_SIZE] = job;
+	server->count++;
+	pthread_cond_signal(&server->queued);
+	pthread_mutex_unlock(&server->lock);
+}
+
+static Job *pop_job(Server *server) {
+	pthread_mutex_lock(&server->lock);
+	while (server->count == 0) {
+		pthread_cond_wait(&server->queued, &server->lock);
+	}
+	Job *job = server->queue[server->head];
+	server->head = (server->head + 1) % SERVE_QUEUE_SIZE;
+	server->count--;
+	pthread_cond_signal(&server->dequeued);
+	pthread_mutex_unlock(&server->lock);
+	return job;
+}
+
+// --
+// -- Machine pool
+// --
+
+// FNV-1a over words rather than bytes; the tail is padded with zeros as
+// guest memory is
+static uint64_t image_hash(const uint8_t *image, size_t length) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < length; i += sizeof(uint64_t)) {
+		uint64_t word = 0;
+		memcpy(&word, &image[i], length - i < sizeof(uint64_t) ? length - i : sizeof(uint64_t));
+		hash = (hash ^ word) * 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// An idle machine that last ran the image, or else the one idle longest.
+// There are more machines than workers, so one is always idle.
+
+static Pool_Machine *acquire_machine(Server *server, uint64_t hash) {
+	pthread_mutex_lock(&server->lock);
+	Pool_Machine *chosen = NULL;
+	for (uint32_t i = 0; i < server->machines_num; i++) {
+		Pool_Machine *machine = &server->machines[i];
+		if (machine->busy) {
+			continue;
+		}
+		if (machine->image_hash == hash) {
+			chosen = machine;
+			break;
+		}
+		if (chosen == NULL || machine->last_used < chosen->last_used) {
+			chosen = machine;
+		}
+	}
+	chosen->busy = true;
+	chosen->image_hash = hash;
+	chosen->last_used = ++server->clock;
+	pthread_mutex_unlock(&server->lock);
+	return chosen;
+}
+
+static void release_machine(Server *server, Pool_Machine *machine) {
+	pthread_mutex_lock(&server->lock);
+	machine->busy = false;
+	pthread_mutex_unlock(&server->lock);
+}
+
+// --
+// -- Workers
+// --
+
+static void *work(void *arg) {
+	Server *server = arg;
+	const Serve_Config *config = server->config;
+	uint8_t *reply = malloc(sizeof(Serve_Reply) + DUMP_MAX_SIZE);
+	if (reply == NULL) {
+		fprintf(stderr,"Could not allocate a worker\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (;;) {
+		Job *job = pop_job(server);
+		Serve_Request *request = &job->request;
+		Pool_Machine *machine = acquire_machine(server, image_hash(job->image, request->image_size));
+		Machine *arm = machine->arm;
+
+		armemu_reload(arm, job->image, request->image_size);
+		armemu_set_fusion(arm, !(request->flags & SERVE_NO_FUSION));
+		uint64_t max_steps = request->max_steps ? request->max_steps : config->max_steps;
+		uint64_t max_wall_ms = request->max_wall_ms ? request->max_wall_ms : config->max_wall_ms;
+		if (max_steps || max_wall_ms) {
+			armemu_run_limited(arm, max_steps, max_wall_ms);
+		} else {
+			armemu_run(arm);
+		}
+		size_t length = dump_binary_buffer(arm, reply + sizeof(Serve_Reply));
+		release_machine(server, machine);
+
+		Serve_Reply header = {SERVE_REPLY_MAGIC, request->id, SERVE_OK, length};
+		memcpy(reply, &header, sizeof(Serve_Reply));
+
+		Connection *conn = job->conn;
+		free(job);
+		pthread_mutex_lock(&conn->lock);
+		send_reply(conn, reply, sizeof(Serve_Reply) + length);
+		conn->inflight--;
+		pthread_cond_signal(&conn->answered);
+		bool last = conn->closed && conn->inflight == 0;
+		pthread_mutex_unlock(&conn->lock);
+		if (last) {
+			free_connection(conn);
+		}
+	}
+	return NULL;
+}
+
+// --
+// -- Connections
+// --
+// Each connection has a thread reading its requests into jobs, waiting
+// before each for the connection to have fewer than SERVE_MAX_INFLIGHT.
+
+static void *read_requests(void *arg) {
+	Connection *conn = arg;
+
+	for (;;) {
+		pthread_mutex_lock(&conn->lock);
+		while (conn->inflight == SERVE_MAX_INFLIGHT) {
+			pthread_cond_wait(&conn->answered, &conn->lock);
+		}
+		pthread_mutex_unlock(&conn->lock);
+
+		Serve_Request request;
+		if (!read_all(conn->fd, &request, sizeof(Serve_Request))) {
+			break;
+		}
+		uint32_t status = SERVE_OK;
+		if (request.magic != SERVE_REQUEST_MAGIC) {
+			status = SERVE_BAD_MAGIC;
+		} else if (request.image_size >= MEMORY_SIZE) {
+			status = SERVE_IMAGE_TOO_LARGE;
+		}
+		if (status != SERVE_OK) {
+			Serve_Reply reply = {SERVE_REPLY_MAGIC, request.id, status, 0};
+			pthread_mutex_lock(&conn->lock);
+			send_reply(conn, &reply, sizeof(Serve_Reply));
+			pthread_mutex_unlock(&conn->lock);
+			break;
+		}
+
+		Job *job = malloc(sizeof(Job) + request.image_size);
+		if (job == NULL) {
+			break;
+		}
+		job->conn = conn;
+		job->request = request;
+		if (!read_all(conn->fd, job->image, request.image_size)) {
+			free(job);
+			break;
+		}
+		pthread_mutex_lock(&conn->lock);
+		conn->inflight++;
+		pthread_mutex_unlock(&conn->lock);
+		push_job(conn->server, job);
+	}
+
+	shutdown(conn->fd, SHUT_RD);
+	pthread_mutex_lock(&conn->lock);
+	conn->closed = true;
+	bool last = conn->inflight == 0;
+	pthread_mutex_unlock(&conn->lock);
+	if (last) {
+		free_connection(conn);
+	}
+	return NULL;
+}
+
+static bool accept_connection(Server *server, int fd) {
+	Connection *conn = malloc(sizeof(Connection));
+	if (conn == NULL) {
+		return false;
+	}
+	conn->server = server;
+	conn->fd = fd;
+	pthread_mutex_init(&conn->lock, NULL);
+	pthread_cond_init(&conn->answered, NULL);
+	conn->inflight = 0;
+	conn->closed = false;
+	conn->broken = false;
+
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, read_requests, conn)) {
+		free_connection(conn);
+		return false;
+	}
+	pthread_detach(thread);
+	return true;
+}
+
+// --
+// -- Daemon
+// --
+
+static bool start_workers(Server *server, uint32_t threads) {
+	server->machines_num = threads * MACHINES_PER_THREAD;
+	server->machines = calloc(server->machines_num, sizeof(Pool_Machine));
+	// one block, on huge pages once the pool reaches 2 MiB
+	uint8_t *storage = armemu_alloc_machines(server->machines_num);
+	if (server->machines == NULL || storage == NULL) {
+		return false;
+	}
+	for (uint32_t i = 0; i < server->machines_num; i++) {
+		server->machines[i].arm = armemu_init(storage + i * armemu_machine_size());
+		server->machines[i].image_hash = image_hash(NULL, 0);
+	}
+	for (uint32_t i = 0; i < threads; i++) {
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, work, server)) {
+			return false;
+		}
+		pthread_detach(thread);
+	}
+	return true;
+}
+
+static int listen_on(const char *path) {
+	struct sockaddr_un address;
+	if (strlen(path) >= sizeof(address.sun_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		return -1;
+	}
+	unlink(path);
+	if (bind(fd, (struct sockaddr *) &address, sizeof(address)) || listen(fd, LISTEN_BACKLOG)) {
+		int error = errno;
+		close(fd);
+		errno = error;
+		return -1;
+	}
+	return fd;
+}
+
+int serve(const Serve_Config *config) {
+	static Server server;
+	server.config = config;
+	pthread_mutex_init(&server.lock, NULL);
+	pthread_cond_init(&server.queued, NULL);
+	pthread_cond_init(&server.dequeued, NULL);
+
+	uint32_t threads = config->threads;
+	if (threads == 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = cpus > 0 ? cpus : 1;
+	}
+	if (!start_workers(&server, threads)) {
+		fprintf(stderr,"Could not start the workers");
+		return EXIT_FAILURE;
+	}
+
+	int listener = listen_on(config->path);
+	if (listener < 0) {
+		fprintf(stderr,"Could not listen on %s: %s",config->path,strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	// replies to clients gone are dropped rather than killing the daemon;
+	// the stop signals interrupt accept()
+	signal(SIGPIPE, SIG_IGN);
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = stop;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+
+	fprintf(stderr,"Serving on %s with %u workers\n",config->path,threads);
+	while (!stopping) {
+		int fd = accept(listener, NULL, NULL);
+		if (fd < 0) {
+			if (errno != EINTR && errno != ECONNABORTED) {
+				fprintf(stderr,"accept failed: %s\n",strerror(errno));
+			}
+			continue;
+		}
+		if (!accept_connection(&server, fd)) {
+			close(fd);
+		}
+	}
+
+	close(listener);
+	unlink(config->path);
+	return EXIT_SUCCESS;
+}
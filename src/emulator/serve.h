@@ -0,0 +1,73 @@
+#ifndef ARM11_18_SERVE_H
+#define ARM11_18_SERVE_H
+
+#include <stdint.h>
+
+// --
+// -- Emulation daemon
+// --
+// 'emulate --serve=path' listens on a Unix stream socket and runs the
+// guest images sent to it on a pool of worker threads, so a job costs no
+// process start and no machine allocation. Machines are kept between jobs
+// with their decode cache, a job going to an idle machine that last ran
+// the same image when there is one. Jobs have no devices mapped, and
+// nothing they do is printed.
+//
+// A connection carries any number of requests, each a Serve_Request then
+// 'image_size' bytes of image, without waiting for the replies. Replies
+// are a Serve_Reply then 'length' bytes of binary state dump (see
+// state_dump.h), sent as jobs finish: jobs of one connection run in
+// parallel and may be answered out of order, 'id' telling them apart.
+// A connection has at most SERVE_MAX_INFLIGHT jobs queued or running;
+// beyond that the daemon stops reading it until one is answered, so a
+// client writing faster than the jobs run blocks in its writes. A
+// malformed request is answered with an error and the connection closed.
+//
+// All fields are little-endian.
+
+#define SERVE_REQUEST_MAGIC 0x4a4d5241 // "ARMJ"
+#define SERVE_REPLY_MAGIC 0x524d5241 // "ARMR"
+
+#define SERVE_MAX_INFLIGHT 64
+#define SERVE_QUEUE_SIZE 256
+
+// request flags
+#define SERVE_NO_FUSION (1u << 0)
+
+struct Serve_Request {
+	uint32_t magic;
+	uint32_t id;            // echoed in the reply
+	uint32_t flags;
+	uint32_t image_size;    // bytes, less than the guest memory size
+	uint64_t max_steps;     // 0 for the daemon's limit
+	uint64_t max_wall_ms;   // 0 for the daemon's limit
+};  // 32 bytes, no padding
+typedef struct Serve_Request Serve_Request;
+
+enum serve_status {
+	SERVE_OK,               // the dump of the final state follows
+	SERVE_BAD_MAGIC,
+	SERVE_IMAGE_TOO_LARGE
+};
+
+struct Serve_Reply {
+	uint32_t magic;
+	uint32_t id;
+	uint32_t status;        // enum serve_status
+	uint32_t length;        // bytes of dump following
+};
+typedef struct Serve_Reply Serve_Reply;
+
+struct Serve_Config {
+	const char *path;       // socket, replaced if it exists
+	uint32_t threads;       // workers, 0 for one per CPU
+	uint64_t max_steps;     // limits of requests giving none, 0 for none
+	uint64_t max_wall_ms;
+};
+typedef struct Serve_Config Serve_Config;
+
+// Serve until SIGINT or SIGTERM. Returns the exit code, after printing
+// why to stderr if the daemon could not start.
+int serve(const Serve_Config *config);
+
+#endif //ARM11_18_SERVE_H
@@ -0,0 +1,92 @@
+#ifndef ARM11_18_SHIFTER_H
+#define ARM11_18_SHIFTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --
+// -- Operand2 fields and the barrel shifter
+// --
+// Shared by the scalar core and the SIMT lanes, inline so the lane loops
+// can be vectorised.
+
+#define IMM_MASK 0xff
+#define ROTATE_MASK (0xf << 8)
+#define SHIFT_MASK (0xff << 4)
+#define RM_MASK 0xf
+
+// Barrel shifter options
+
+#define LOGICAL_LEFT 0
+#define LOGICAL_RIGHT 1
+#define ARITHM_RIGHT 2
+#define ROTATE_RIGHT 3
+
+#define SHIFT_BY_REGISTER (1 << 4)
+
+// Shift by register, 'amount' being the bottom byte of Rs. The carry is
+// read as the C flag and set to the last bit shifted out; 0 leaves both
+// value and carry alone. Right shifts and rotates all take the low word of
+// one 64 bit arithmetic shift, the word above the value holding what comes
+// in (zeros, the sign or the value again) and the bit below the result the
+// carry. Amounts are clamped so those from 32 up come out of the same shift,
+// and the types picked with selects rather than a switch.
+
+static inline uint32_t shift_value(uint32_t value, uint32_t amount, uint8_t type, uint8_t *carry) {
+	uint32_t clamped = amount > 33 ? 33 : amount;
+	uint64_t left = (uint64_t) value << clamped;
+
+	uint32_t high = type == ARITHM_RIGHT ? -(value >> 31) : type == ROTATE_RIGHT ? value : 0;
+	int64_t wide = (int64_t) ((uint64_t) high << 32 | value);
+	uint32_t by = type == ROTATE_RIGHT ? ((amount - 1) & 31) + 1 : clamped;
+	uint64_t right = (uint64_t) (wide >> (by ? by - 1 : 0));
+
+	uint32_t result = type == LOGICAL_LEFT ? (uint32_t) left : (uint32_t) (right >> 1);
+	uint8_t out = type == LOGICAL_LEFT ? (left >> 32) & 1 : right & 1;
+	*carry = amount ? out : *carry;
+	return amount ? result : value;
+}
+
+// Shift by the 5 bit amount of an instruction, where 0 stands for 32 in
+// right shifts and for RRX, rotating right through the carry, in ROR
+
+static inline uint32_t shift_immediate(uint32_t value, uint32_t amount, uint8_t type, uint8_t *carry) {
+	if (type == ROTATE_RIGHT && amount == 0) {
+		uint32_t extended = (uint32_t) *carry << 31 | value >> 1;
+		*carry = value & 1;
+		return extended;
+	}
+	return shift_value(value, amount || type == LOGICAL_LEFT ? amount : 32, type, carry);
+}
+
+// Register operand2 field, given the values of its Rm and Rs
+
+static inline uint32_t shift_operand(uint32_t operand, uint32_t rm, uint32_t rs, uint8_t *carry) {
+	uint32_t shift = (operand & SHIFT_MASK) >> 4;
+	uint8_t type = ((0x3 << 1) & shift) >> 1;
+	if (operand & SHIFT_BY_REGISTER) {
+		return shift_value(rm, rs & 0xff, type, carry);
+	}
+	return shift_immediate(rm, ((0x1f << 3) & shift) >> 3, type, carry);
+}
+
+// Rs of a register operand2 field shifted by register
+
+static inline uint8_t shift_register(uint32_t operand) {
+	return (operand >> 8) & RM_MASK;
+}
+
+// 8 bit immediate rotated right by twice the rotate field. Only a rotated
+// one sets the carry, to its bit 31.
+
+static inline uint32_t rotate_immediate(uint32_t operand) {
+	uint32_t rotate = 2 * ((operand & ROTATE_MASK) >> 8);
+	uint32_t value = operand & IMM_MASK;
+	return value >> rotate | value << ((32 - rotate) & 31);
+}
+
+static inline bool immediate_rotated(uint32_t operand) {
+	return (operand & ROTATE_MASK) != 0;
+}
+
+#endif //ARM11_18_SHIFTER_H
@@ -0,0 +1,473 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "simt.h"
+#include "armemu.h"
+#include "emulator_processor.h"
+#include "shifter.h"
+#include "semihost.h"
+
+#define NZC_MASK (N_MASK | Z_MASK | C_MASK)
+#define NZCV_MASK (N_MASK | Z_MASK | C_MASK | V_MASK)
+#define NZ_MASK (N_MASK | Z_MASK)
+
+#define LANE(lane) (1u << (lane))
+
+// Lanes in 'exec' are all ones, the others all zeros, so results are
+// merged without a branch per lane.
+
+static uint32_t blend(uint32_t mask, uint32_t value, uint32_t old) {
+	return (value & mask) | (old & ~mask);
+}
+
+static void lane_fault(Simt *simt, int lane, enum armemu_fault fault, uint32_t address) {
+	simt->fault[lane] = fault;
+	simt->fault_addr[lane] = address;
+}
+
+// --
+// -- Lanes lifetime
+// --
+
+Simt *simt_create(void) {
+	Simt *simt = calloc(1, sizeof(Simt));
+	return simt;
+}
+
+void simt_destroy(Simt *simt) {
+	free(simt);
+}
+
+bool simt_load(Simt *simt, const uint8_t *image, size_t length) {
+	memset(simt, 0, sizeof(Simt));
+	if (length >= MEMORY_SIZE) {
+		for (int l = 0; l < SIMT_LANES; l++) {
+			lane_fault(simt, l, ARMEMU_IMAGE_TOO_LARGE, 0);
+		}
+		return false;
+	}
+	for (int l = 0; l < SIMT_LANES; l++) {
+		memcpy(simt->memory[l], image, length);
+		simt->reg[SP_REG][l] = MEMORY_SIZE;
+		simt->reg[PC_REG][l] = PIPELINE_OFFSET;
+	}
+	// same limit as armemu_load()
+	simt->stack_limit = (length + 1) / 4 * 4 + 1;
+	simt->running = SIMT_LANES == 32 ? 0xffffffff : LANE(SIMT_LANES) - 1;
+	return true;
+}
+
+void simt_invalidate(Simt *simt, uint32_t address, size_t length) {
+	for (size_t i = 0; i < length && address + i < MEMORY_SIZE; i += sizeof(uint32_t)) {
+		simt->written[(address + i) / 4] = true;
+	}
+	if (length && address + length - 1 < MEMORY_SIZE) {
+		simt->written[(address + length - 1) / 4] = true;
+	}
+}
+
+void simt_lane_state(Simt *simt, int lane, Machine *arm) {
+	armemu_reset(arm);
+	memcpy(arm->memory, simt->memory[lane], MEMORY_SIZE);
+	for (int r = 0; r < GENERAL_REGISTERS_NUM; r++) {
+		arm->general_reg[r] = simt->reg[r][lane];
+	}
+	arm->pc_reg = simt->reg[PC_REG][lane];
+	arm->cpsr_reg = simt->cpsr[lane];
+	arm->stack_limit = simt->stack_limit;
+	arm->steps = simt->steps[lane];
+	arm->fault = simt->fault[lane];
+	arm->fault_addr = simt->fault_addr[lane];
+	arm->end = true;
+}
+
+// --
+// -- Vector operations, one loop over the lanes each
+// --
+
+// Operand2 as decode_operand2() computes it, 'operand' an immediate
+// already rotated when 'imm'. The shifter carry starts as each lane's C
+// flag and is only kept for the lanes executing.
+
+static void operand2(Simt *simt, uint32_t operand, bool imm, bool rotated, const Lanes exec, Lanes op2) {
+	uint8_t carry[SIMT_LANES];
+	for (int l = 0; l < SIMT_LANES; l++) {
+		carry[l] = (simt->cpsr[l] & C_MASK) != 0;
+	}
+	if (imm) {
+		for (int l = 0; l < SIMT_LANES; l++) {
+			op2[l] = operand;
+			carry[l] = rotated ? operand >> 31 : carry[l];
+		}
+	} else {
+		uint32_t *rm = simt->reg[operand & RM_MASK];
+		uint32_t *rs = simt->reg[shift_register(operand)];
+		for (int l = 0; l < SIMT_LANES; l++) {
+			op2[l] = shift_operand(operand, rm[l], rs[l], &carry[l]);
+		}
+	}
+	for (int l = 0; l < SIMT_LANES; l++) {
+		simt->shifter_carry[l] = exec[l] ? carry[l] : simt->shifter_carry[l];
+	}
+}
+
+static void data_process_lanes(Simt *simt, Decoded_Instr *instr, const Lanes exec) {
+	Lanes op2;
+	Lanes res;
+	Lanes carry;
+	Lanes overflow = { 0 };         // in the sign bit
+	uint32_t written = NZC_MASK;    // and V, by the arithmetic ones
+	uint32_t *op1 = simt->reg[instr->rn];
+	operand2(simt, instr->operand.op2, instr->imm, instr->accum, exec, op2);
+
+	switch (instr->opcode) {
+	case OPCODE_AND:
+	case OPCODE_TST:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op1[l] & op2[l];
+			carry[l] = simt->shifter_carry[l] != 0;
+		}
+		break;
+	case OPCODE_EOR:
+	case OPCODE_TEQ:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op1[l] ^ op2[l];
+			carry[l] = simt->shifter_carry[l] != 0;
+		}
+		break;
+	case OPCODE_SUB:
+	case OPCODE_CMP:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op1[l] - op2[l];
+			carry[l] = op1[l] >= op2[l];
+			overflow[l] = (op1[l] ^ op2[l]) & (op1[l] ^ res[l]) & N_MASK;
+		}
+		written = NZCV_MASK;
+		break;
+	case OPCODE_RSB:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op2[l] - op1[l];
+			carry[l] = op2[l] >= op1[l];
+			overflow[l] = (op2[l] ^ op1[l]) & (op2[l] ^ res[l]) & N_MASK;
+		}
+		written = NZCV_MASK;
+		break;
+	case OPCODE_ADD:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op1[l] + op2[l];
+			carry[l] = res[l] < op1[l];
+			overflow[l] = ~(op1[l] ^ op2[l]) & (op1[l] ^ res[l]) & N_MASK;
+		}
+		written = NZCV_MASK;
+		break;
+	case OPCODE_ORR:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op1[l] | op2[l];
+			carry[l] = simt->shifter_carry[l] != 0;
+		}
+		break;
+	case OPCODE_MOV:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			res[l] = op2[l];
+			carry[l] = simt->shifter_carry[l] != 0;
+		}
+		break;
+	default:
+		return;         // not implemented by the scalar core either
+	}
+
+	if (instr->opcode != OPCODE_TST && instr->opcode != OPCODE_TEQ && instr->opcode != OPCODE_CMP) {
+		uint32_t *rd = simt->reg[instr->rd];
+		for (int l = 0; l < SIMT_LANES; l++) {
+			rd[l] = blend(exec[l], res[l], rd[l]);
+		}
+	}
+	if (instr->set) {
+		for (int l = 0; l < SIMT_LANES; l++) {
+			uint32_t flags = (res[l] & N_MASK) | (res[l] ? 0 : Z_MASK) | (carry[l] ? C_MASK : 0)
+			                 | (overflow[l] ? V_MASK : 0);
+			simt->cpsr[l] = blend(exec[l], (simt->cpsr[l] & ~written) | flags, simt->cpsr[l]);
+		}
+	}
+}
+
+static void multiply_lanes(Simt *simt, Decoded_Instr *instr, const Lanes exec) {
+	uint32_t *rm = simt->reg[instr->operand.mul.rm];
+	uint32_t *rs = simt->reg[instr->operand.mul.rs];
+	uint32_t *rn = simt->reg[instr->rn];
+	uint32_t *rd = simt->reg[instr->rd];
+	uint32_t accum = instr->accum ? 0xffffffff : 0;
+	Lanes res;
+	for (int l = 0; l < SIMT_LANES; l++) {
+		res[l] = rm[l] * rs[l] + (rn[l] & accum);
+		rd[l] = blend(exec[l], res[l], rd[l]);
+	}
+	if (instr->set) {
+		for (int l = 0; l < SIMT_LANES; l++) {
+			uint32_t flags = (res[l] & N_MASK) | (res[l] ? 0 : Z_MASK);
+			simt->cpsr[l] = blend(exec[l], (simt->cpsr[l] & ~NZ_MASK) | flags, simt->cpsr[l]);
+		}
+	}
+}
+
+// --
+// -- Memory operations, lane by lane
+// --
+
+static void mark_written(Simt *simt, uint32_t address) {
+	simt->written[address / 4] = true;
+	simt->written[(address + sizeof(uint32_t) - 1) / 4] = true;
+}
+
+static void data_transfer_lanes(Simt *simt, Decoded_Instr *instr, const Lanes exec) {
+	Lanes offset;
+	if (!instr->imm) {   // opposed to data instr imm
+		for (int l = 0; l < SIMT_LANES; l++) {
+			offset[l] = instr->operand.offset;
+		}
+	} else {
+		operand2(simt, instr->operand.offset, false, false, exec, offset);
+	}
+
+	for (int l = 0; l < SIMT_LANES; l++) {
+		if (!exec[l]) {
+			continue;
+		}
+		uint32_t lane_offset = instr->up ? offset[l] : -offset[l];
+		uint32_t address = simt->reg[instr->rn][l];
+		if (instr->pre_index) {
+			address += lane_offset;
+		} else if (instr->rn != PC_REG) {
+			simt->reg[instr->rn][l] += lane_offset;
+		}
+
+		if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+			lane_fault(simt, l, ARMEMU_OUT_OF_BOUNDS, address);
+			continue;
+		}
+		if (instr->load) {
+			memcpy(&simt->reg[instr->rd][l], &simt->memory[l][address], sizeof(uint32_t));
+		} else {
+			memcpy(&simt->memory[l][address], &simt->reg[instr->rd][l], sizeof(uint32_t));
+			mark_written(simt, address);
+		}
+	}
+}
+
+// Lanes run the call one after the other, each on its own memory
+
+static void semihost_lanes(Simt *simt, Decoded_Instr *instr, const Lanes exec) {
+	for (int l = 0; l < SIMT_LANES; l++) {
+		if (!exec[l]) {
+			continue;
+		}
+		uint32_t reg[3] = {simt->reg[0][l], simt->reg[1][l], simt->reg[2][l]};
+		uint32_t bad_address;
+		int64_t written = semihost_call(instr->operand.call, simt->memory[l], reg, &bad_address);
+		if (written < 0) {
+			lane_fault(simt, l, ARMEMU_OUT_OF_BOUNDS, bad_address);
+			continue;
+		}
+		simt_invalidate(simt, simt->reg[0][l], written);
+		simt->reg[0][l] = reg[0];
+	}
+}
+
+// Same addressing as multi_transfer(). Returns the lanes stopped on the
+// stack limit.
+
+static uint32_t multi_transfer_lanes(Simt *simt, Decoded_Instr *instr, const Lanes exec) {
+	uint32_t stopped = 0;
+	uint32_t list = instr->operand.register_list;
+	uint32_t size = 4 * __builtin_popcount(list);
+	bool pre_index = instr->up ? !instr->pre_index : instr->pre_index;
+
+	for (int l = 0; l < SIMT_LANES; l++) {
+		if (!exec[l]) {
+			continue;
+		}
+		uint32_t base = simt->reg[instr->rn][l];
+		uint32_t bottom = instr->up ? base : base - size;
+		uint32_t top = bottom + size;
+		if (instr->write_back) {
+			simt->reg[instr->rn][l] = instr->up ? top : bottom;
+			if (top > MEMORY_SIZE || bottom <= simt->stack_limit) {
+				lane_fault(simt, l, ARMEMU_STACK_LIMIT, bottom);
+				stopped |= LANE(l);
+				continue;
+			}
+		}
+
+		uint32_t address = pre_index ? bottom + 4 : bottom;
+		for (uint32_t rest = list; rest; rest &= rest - 1, address += 4) {
+			uint32_t r = __builtin_ctz(rest);
+			if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+				lane_fault(simt, l, ARMEMU_OUT_OF_BOUNDS, address);
+				continue;
+			}
+			if (instr->load) {
+				memcpy(&simt->reg[r][l], &simt->memory[l][address], sizeof(uint32_t));
+			} else {
+				memcpy(&simt->memory[l][address], &simt->reg[r][l], sizeof(uint32_t));
+				mark_written(simt, address);
+			}
+		}
+		if (instr->load && list & LANE(PC_REG)) {
+			simt->reg[PC_REG][l] += 4;      // <- taken branch, the PC moves on 4 more
+		}
+	}
+	return stopped;
+}
+
+// --
+// -- Issue
+// --
+
+static Decoded_Instr *shared_decoded(Simt *simt, uint32_t address) {
+	Decoded_Instr *decoded = &simt->predecoded[address / 4];
+	if (!decoded->exists) {
+		Instr instr;
+		instr.exists = true;
+		memcpy(&instr.bits, &simt->memory[0][address], sizeof(uint32_t));
+		decode(decoded, &instr, NULL);
+	}
+	return decoded;
+}
+
+// Lanes at the lowest PC, the PC being stored in 'pc'
+
+static uint32_t next_group(Simt *simt, uint32_t *pc) {
+	uint32_t lowest = UINT32_MAX;
+	for (int l = 0; l < SIMT_LANES; l++) {
+		if (simt->running & LANE(l) && simt->reg[PC_REG][l] < lowest) {
+			lowest = simt->reg[PC_REG][l];
+		}
+	}
+	uint32_t group = 0;
+	for (int l = 0; l < SIMT_LANES; l++) {
+		if (simt->running & LANE(l) && simt->reg[PC_REG][l] == lowest) {
+			group |= LANE(l);
+		}
+	}
+	*pc = lowest;
+	return group;
+}
+
+// Issue one instruction for 'group', returns the lanes that stopped.
+// 'split' is set if the lanes of the group no longer share a PC.
+
+static uint32_t issue(Simt *simt, uint32_t group, uint32_t pc, bool *split) {
+	uint32_t address = pc - PIPELINE_OFFSET;
+	if (address > MEMORY_SIZE - sizeof(uint32_t)) {
+		for (int l = 0; l < SIMT_LANES; l++) {
+			if (group & LANE(l)) {
+				lane_fault(simt, l, ARMEMU_PC_OUT_OF_RANGE, address);
+			}
+		}
+		return group;
+	}
+
+	Decoded_Instr *instr;
+	Decoded_Instr own;
+	if (!simt->written[address / 4]) {
+		instr = shared_decoded(simt, address);
+	} else {
+		// the word may differ between lanes, issue for those matching the first
+		int first = 0;
+		while (!(group & LANE(first))) {
+			first++;
+		}
+		Instr word;
+		word.exists = true;
+		memcpy(&word.bits, &simt->memory[first][address], sizeof(uint32_t));
+		for (int l = first + 1; l < SIMT_LANES; l++) {
+			if (group & LANE(l) && memcmp(&word.bits, &simt->memory[l][address], sizeof(uint32_t))) {
+				group &= ~LANE(l);
+				*split = true;
+			}
+		}
+		decode(&own, &word, NULL);
+		instr = &own;
+	}
+
+	simt->issued++;
+	for (int l = 0; l < SIMT_LANES; l++) {
+		simt->steps[l] += (group >> l) & 1;
+	}
+	if (instr->type == HALT) {
+		return group;   // <- the PC stays on the instruction after next
+	}
+
+	Lanes exec;
+	uint16_t row = instr->conditional ? cond_table[instr->cond] : 0xffff;
+	for (int l = 0; l < SIMT_LANES; l++) {
+		uint32_t pass = (row >> (simt->cpsr[l] >> 28)) & 1;
+		exec[l] = -(((group >> l) & 1) & pass);
+	}
+
+	uint32_t stopped = 0;
+	uint32_t taken = 0;
+	switch (instr->type) {
+	case DATA_PROC:
+		data_process_lanes(simt, instr, exec);
+		break;
+	case MUL:
+		multiply_lanes(simt, instr, exec);
+		break;
+	case TRANSFER:
+		data_transfer_lanes(simt, instr, exec);
+		break;
+	case MULTI_TRANSFER:
+		stopped = multi_transfer_lanes(simt, instr, exec);
+		*split |= instr->load && instr->operand.register_list & LANE(PC_REG);
+		break;
+	case SEMIHOST:
+		semihost_lanes(simt, instr, exec);
+		break;
+	case BRANCH:
+		for (int l = 0; l < SIMT_LANES; l++) {
+			taken |= (exec[l] & 1) << l;
+		}
+		*split |= taken != 0 && taken != group;
+		break;
+	default:
+		break;
+	}
+
+	uint32_t taken_offset = instr->type == BRANCH ? instr->operand.sgn_offset + PIPELINE_OFFSET : 4;
+	uint32_t *pc_lanes = simt->reg[PC_REG];
+	for (int l = 0; l < SIMT_LANES; l++) {
+		uint32_t advance = blend(exec[l], taken_offset, 4);
+		uint32_t moving = -(((group & ~stopped) >> l) & 1);
+		pc_lanes[l] += advance & moving;
+	}
+	return stopped;
+}
+
+// While every running lane is in the group and none split off, the
+// group stays together and the lowest PC need not be searched for.
+
+uint64_t simt_run(Simt *simt, uint64_t max_steps) {
+	uint64_t start = simt->issued;
+	uint32_t group = 0;
+	uint32_t pc = 0;
+	bool split = true;
+	while (simt->running) {
+		if (split || group != simt->running) {
+			group = next_group(simt, &pc);
+		} else {
+			pc = simt->reg[PC_REG][__builtin_ctz(group)];
+		}
+		split = false;
+		simt->running &= ~issue(simt, group, pc, &split);
+		if (max_steps) {
+			for (int l = 0; l < SIMT_LANES; l++) {
+				if (simt->running & LANE(l) && simt->steps[l] >= max_steps) {
+					lane_fault(simt, l, ARMEMU_STEP_LIMIT, 0);
+					simt->running &= ~LANE(l);
+				}
+			}
+		}
+	}
+	return simt->issued - start;
+}
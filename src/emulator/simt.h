@@ -0,0 +1,67 @@
+#ifndef ARM11_18_SIMT_H
+#define ARM11_18_SIMT_H
+
+#include <stddef.h>
+#include "define_structures.h"
+
+// --
+// -- Lockstep execution of many instances of one program (SIMT)
+// --
+// Every lane is a separate guest with its own registers and memory, all
+// loaded with the same image. Lanes at the same PC issue each instruction
+// together, ALU, multiply and shifter work running across the lanes in
+// one loop the compiler can vectorise. Lanes that branch apart are masked
+// off and picked up again once they are back at the same PC: the lowest
+// PC always issues first, so the lanes left behind catch up.
+//
+// Lanes have no memory-mapped devices, accesses outside guest memory are
+// recorded as ARMEMU_OUT_OF_BOUNDS.
+
+#ifndef SIMT_LANES
+#define SIMT_LANES 8     // up to 32, build with -DSIMT_LANES=16 for AVX-512
+#endif
+
+typedef uint32_t Lanes[SIMT_LANES];
+
+struct Simt {
+	Lanes reg[PC_REG + 1];      // r0 - r14, then the PC 8 bytes ahead
+	Lanes cpsr;
+	uint8_t shifter_carry[SIMT_LANES];
+	uint32_t running;           // bit per lane still executing
+	uint64_t steps[SIMT_LANES];
+	uint32_t fault[SIMT_LANES]; // enum armemu_fault
+	uint32_t fault_addr[SIMT_LANES];
+	uint32_t stack_limit;
+	uint64_t issued;            // instructions issued, each for one or more lanes
+
+	// Words never stored to hold the same instruction in every lane and
+	// share one decoded copy; stored words are decoded per issue.
+	Decoded_Instr predecoded[MEMORY_SIZE / 4];
+	bool written[MEMORY_SIZE / 4];
+
+	uint8_t memory[SIMT_LANES][MEMORY_SIZE];
+};
+typedef struct Simt Simt;
+
+// Allocate a halted set of lanes. Returns NULL if out of memory.
+Simt *simt_create(void);
+
+void simt_destroy(Simt *simt);
+
+// Reset every lane and copy 'image' to address 0 of each, all lanes
+// running. Returns false if the image does not fit.
+bool simt_load(Simt *simt, const uint8_t *image, size_t length);
+
+// Memory of a lane changed between simt_load() and simt_run() must be
+// invalidated here, as it may no longer match the other lanes.
+void simt_invalidate(Simt *simt, uint32_t address, size_t length);
+
+// Run until every lane halts or faults. A lane stops with
+// ARMEMU_STEP_LIMIT after 'max_steps' instructions, 0 meaning no limit.
+// Returns the instructions issued.
+uint64_t simt_run(Simt *simt, uint64_t max_steps);
+
+// Copy the state of 'lane' into 'arm', to be dumped as a single machine.
+void simt_lane_state(Simt *simt, int lane, Machine *arm);
+
+#endif //ARM11_18_SIMT_H
@@ -0,0 +1,217 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "state_dump.h"
+
+#define WORD_SIZE 4
+#define WORDS_NUM (MEMORY_SIZE / WORD_SIZE)
+#define OUT_BUFFER_SIZE (1 << 16)
+
+bool parse_output_format(const char *name, enum output_format *format) {
+	if (!strcmp(name, "text")) {
+		*format = OUTPUT_TEXT;
+	} else if (!strcmp(name, "json")) {
+		*format = OUTPUT_JSON;
+	} else if (!strcmp(name, "binary")) {
+		*format = OUTPUT_BINARY;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+// --
+// -- Non-zero memory ranges
+// --
+
+// Finds the next run of non-zero words at or after word index 'from'.
+// Zero memory is skipped 8 bytes at a time. Returns false if none is left.
+
+static bool next_range(const uint8_t *memory, uint32_t from, Dump_Range *range) {
+	uint32_t i = from;
+	uint32_t word;
+	uint64_t pair;
+
+	if (i & 1) {
+		memcpy(&word, &memory[i * WORD_SIZE], WORD_SIZE);
+		if (!word) {
+			i++;
+		}
+	}
+	while (i < WORDS_NUM && !(i & 1)) {
+		memcpy(&pair, &memory[i * WORD_SIZE], sizeof(uint64_t));
+		if (pair) {
+			break;
+		}
+		i += 2;
+	}
+	if (i >= WORDS_NUM) {
+		return false;
+	}
+	memcpy(&word, &memory[i * WORD_SIZE], WORD_SIZE);
+	if (!word) {
+		i++;
+	}
+
+	range->address = i * WORD_SIZE;
+	do {
+		i++;
+		if (i == WORDS_NUM) {
+			break;
+		}
+		memcpy(&word, &memory[i * WORD_SIZE], WORD_SIZE);
+	} while (word);
+	range->words = i - range->address / WORD_SIZE;
+	return true;
+}
+
+// --
+// -- Binary
+// --
+
+size_t dump_binary_buffer(Machine *arm, uint8_t *buffer) {
+	Dump_Header header;
+	memset(&header, 0, sizeof(Dump_Header));
+	header.magic = DUMP_MAGIC;
+	header.version = DUMP_VERSION;
+	memcpy(header.general_reg, arm->general_reg, sizeof(header.general_reg));
+	header.pc_reg = arm->pc_reg;
+	header.cpsr_reg = arm->cpsr_reg;
+	header.fault = arm->fault;
+	header.memory_size = MEMORY_SIZE;
+	header.steps = arm->steps;
+
+	// ranges go after the header, which is written last with their count
+	size_t length = sizeof(Dump_Header);
+	Dump_Range range;
+	uint32_t from = 0;
+	while (next_range(arm->memory, from, &range)) {
+		memcpy(&buffer[length], &range, sizeof(Dump_Range));
+		length += sizeof(Dump_Range);
+		memcpy(&buffer[length], &arm->memory[range.address], range.words * WORD_SIZE);
+		length += range.words * WORD_SIZE;
+		from = range.address / WORD_SIZE + range.words;
+		header.range_count++;
+	}
+	memcpy(buffer, &header, sizeof(Dump_Header));
+	return length;
+}
+
+void dump_binary(Machine *arm, FILE *out) {
+	uint8_t *buffer = malloc(DUMP_MAX_SIZE);
+	size_t length = dump_binary_buffer(arm, buffer);
+	fwrite(buffer, 1, length, out);
+	free(buffer);
+}
+
+// --
+// -- JSON
+// --
+// Written through a local buffer with hand-rolled number formatting,
+// nothing is built up in memory besides the buffer itself. Without a file
+// the buffer is the caller's and holds the whole dump.
+
+struct Json_Out {
+	char *data;
+	size_t capacity;
+	size_t length;
+	FILE *out;
+};
+typedef struct Json_Out Json_Out;
+
+static void json_flush(Json_Out *json) {
+	if (json->out != NULL) {
+		fwrite(json->data, 1, json->length, json->out);
+		json->length = 0;
+	}
+}
+
+static void json_str(Json_Out *json, const char *str) {
+	size_t n = strlen(str);
+	if (json->length + n > json->capacity) {
+		json_flush(json);
+	}
+	memcpy(&json->data[json->length], str, n);
+	json->length += n;
+}
+
+static void json_uint(Json_Out *json, uint64_t val) {
+	char digits[20];
+	int n = 0;
+	do {
+		digits[n++] = '0' + val % 10;
+		val /= 10;
+	} while (val);
+	if (json->length + n > json->capacity) {
+		json_flush(json);
+	}
+	while (n) {
+		json->data[json->length++] = digits[--n];
+	}
+}
+
+static void write_json(Machine *arm, Json_Out *json) {
+	json_str(json, "{\"registers\":[");
+	for (int i = 0; i < GENERAL_REGISTERS_NUM; i++) {
+		if (i) {
+			json_str(json, ",");
+		}
+		json_uint(json, arm->general_reg[i]);
+	}
+	json_str(json, "],\"pc\":");
+	json_uint(json, arm->pc_reg);
+	json_str(json, ",\"cpsr\":");
+	json_uint(json, arm->cpsr_reg);
+	json_str(json, ",\"fault\":");
+	json_uint(json, arm->fault);
+	json_str(json, ",\"steps\":");
+	json_uint(json, arm->steps);
+	json_str(json, ",\"memory\":[");
+
+	Dump_Range range;
+	uint32_t from = 0;
+	while (next_range(arm->memory, from, &range)) {
+		json_str(json, from ? ",{\"address\":" : "{\"address\":");
+		json_uint(json, range.address);
+		json_str(json, ",\"words\":[");
+		for (uint32_t i = 0; i < range.words; i++) {
+			uint32_t word;
+			memcpy(&word, &arm->memory[range.address + i * WORD_SIZE], WORD_SIZE);
+			if (i) {
+				json_str(json, ",");
+			}
+			json_uint(json, word);
+		}
+		json_str(json, "]}");
+		from = range.address / WORD_SIZE + range.words;
+	}
+	json_str(json, "]}\n");
+}
+
+void dump_json(Machine *arm, FILE *out) {
+	Json_Out json = {malloc(OUT_BUFFER_SIZE), OUT_BUFFER_SIZE, 0, out};
+	write_json(arm, &json);
+	json_flush(&json);
+	free(json.data);
+}
+
+size_t dump_json_buffer(Machine *arm, uint8_t *buffer) {
+	Json_Out json = {(char *) buffer, DUMP_JSON_MAX_SIZE, 0, NULL};
+	write_json(arm, &json);
+	return json.length;
+}
+
+// --
+// -- Any format
+// --
+
+size_t format_state(Machine *arm, enum output_format format, bool stack_mode, uint8_t *buffer) {
+	switch(format) {
+	case OUTPUT_JSON:
+		return dump_json_buffer(arm, buffer);
+	case OUTPUT_BINARY:
+		return dump_binary_buffer(arm, buffer);
+	default:
+		return format_machine_status(arm, stack_mode, (char *) buffer);
+	}
+}
@@ -0,0 +1,75 @@
+#ifndef ARM11_18_STATE_DUMP_H
+#define ARM11_18_STATE_DUMP_H
+
+#include <stdio.h>
+#include "define_structures.h"
+#include "decode_helpers.h"
+
+// --
+// -- Machine readable final state
+// --
+
+#define DUMP_MAGIC 0x534d5241 // "ARMS"
+#define DUMP_VERSION 1
+
+enum output_format {
+	OUTPUT_TEXT,
+	OUTPUT_JSON,
+	OUTPUT_BINARY
+};
+
+// Binary dump, all fields little-endian:
+// a Dump_Header, then 'range_count' ranges of consecutive non-zero words,
+// each a Dump_Range followed by 'words' raw memory words.
+
+struct Dump_Header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t steps;
+	uint32_t general_reg[GENERAL_REGISTERS_NUM];
+	uint32_t pc_reg;
+	uint32_t cpsr_reg;
+	uint32_t fault;
+	uint32_t memory_size;
+	uint32_t range_count;
+};  // 96 bytes, no padding
+typedef struct Dump_Header Dump_Header;
+
+struct Dump_Range {
+	uint32_t address;
+	uint32_t words;
+};
+typedef struct Dump_Range Dump_Range;
+
+// parses "text", "json" or "binary", returns false otherwise
+bool parse_output_format(const char *name, enum output_format *format);
+
+// Largest binary dump: no two words in a row non-zero gives the most ranges
+#define DUMP_MAX_SIZE (sizeof(Dump_Header) \
+                       + (MEMORY_SIZE / 8 + 1) * sizeof(Dump_Range) + MEMORY_SIZE)
+
+void dump_binary(Machine *arm, FILE *out);
+
+// Write the binary dump to 'buffer', of at least DUMP_MAX_SIZE bytes.
+// Returns the bytes written.
+size_t dump_binary_buffer(Machine *arm, uint8_t *buffer);
+
+// {"registers":[r0..r14],"pc":..,"cpsr":..,"fault":..,"steps":..,
+//  "memory":[{"address":..,"words":[..]},..]}
+// memory words are the values a word load would return
+void dump_json(Machine *arm, FILE *out);
+
+// Longest JSON dump: no two words in a row non-zero, each of ten digits
+#define DUMP_JSON_MAX_SIZE (512 + (MEMORY_SIZE / 8 + 1) * 32 + (MEMORY_SIZE / 4) * 11)
+
+// Write the JSON dump to 'buffer', of at least DUMP_JSON_MAX_SIZE bytes.
+// Returns the bytes written.
+size_t dump_json_buffer(Machine *arm, uint8_t *buffer);
+
+// Any of the formats, the text one being print_machine_status()'s
+#define STATE_MAX_SIZE (DUMP_JSON_MAX_SIZE > MACHINE_STATUS_MAX_SIZE \
+                        ? DUMP_JSON_MAX_SIZE : MACHINE_STATUS_MAX_SIZE)
+
+size_t format_state(Machine *arm, enum output_format format, bool stack_mode, uint8_t *buffer);
+
+#endif //ARM11_18_STATE_DUMP_H
@@ -0,0 +1,433 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "timing.h"
+#include "emulator_processor.h"
+#include "shifter.h"
+
+const Timing_Config timing_default_config = {
+	.icache = {16 * 1024, 32, 4},
+	.dcache = {16 * 1024, 32, 4},
+	.predictor_entries = 128,
+	.miss_penalty = 20,
+	.mispredict_penalty = 5
+};
+
+// --
+// -- Caches
+// --
+
+static bool power_of_two(uint32_t value) {
+	return value && !(value & (value - 1));
+}
+
+static bool cache_init(Cache *cache, const Cache_Config *config) {
+	if (!power_of_two(config->size) || !power_of_two(config->line) || !power_of_two(config->ways)
+	    || config->line < 4 || config->size < config->line * config->ways) {
+		return false;
+	}
+	cache->ways = config->ways;
+	cache->sets = config->size / (config->line * config->ways);
+	cache->line_shift = __builtin_ctz(config->line);
+	cache->tags = calloc(cache->sets * cache->ways, sizeof(uint32_t));
+	cache->used = calloc(cache->sets * cache->ways, sizeof(uint64_t));
+	return cache->tags != NULL && cache->used != NULL;
+}
+
+// Look 'line' up in its set, filling the least recently used way on a
+// miss. Returns true on a hit.
+
+static bool cache_access(Cache *cache, uint32_t line) {
+	uint32_t set = line & (cache->sets - 1);
+	uint32_t *tags = &cache->tags[set * cache->ways];
+	uint64_t *used = &cache->used[set * cache->ways];
+	uint32_t victim = 0;
+
+	cache->accesses++;
+	cache->clock++;
+	for (uint32_t way = 0; way < cache->ways; way++) {
+		if (tags[way] == line + 1) {
+			used[way] = cache->clock;
+			return true;
+		}
+		if (used[way] < used[victim]) {
+			victim = way;
+		}
+	}
+	cache->misses++;
+	tags[victim] = line + 1;
+	used[victim] = cache->clock;
+	return false;
+}
+
+// --
+// -- Model lifetime
+// --
+
+Timing *timing_create(const Timing_Config *config) {
+	Timing *timing = calloc(1, sizeof(Timing));
+	if (timing == NULL) {
+		return NULL;
+	}
+	timing->config = *config;
+	bool valid = cache_init(&timing->icache, &config->icache)
+	             && cache_init(&timing->dcache, &config->dcache)
+	             && power_of_two(config->predictor_entries);
+	if (valid) {
+		timing->counters = malloc(config->predictor_entries);
+	}
+	if (timing->counters == NULL) {
+		timing_destroy(timing);
+		return NULL;
+	}
+	memset(timing->counters, 1, config->predictor_entries);  // weakly not taken
+	timing->block_ends = true;
+	return timing;
+}
+
+void timing_destroy(Timing *timing) {
+	if (timing == NULL) {
+		return;
+	}
+	free(timing->icache.tags);
+	free(timing->icache.used);
+	free(timing->dcache.tags);
+	free(timing->dcache.used);
+	free(timing->counters);
+	free(timing);
+}
+
+bool timing_attach(Timing *timing, Machine *arm) {
+#ifdef ARMEMU_TIMING
+	arm->timing = timing;
+	return true;
+#else
+	(void) timing;
+	(void) arm;
+	return false;
+#endif
+}
+
+// --
+// -- Events
+// --
+
+static void charge(Timing *timing, Timing_Pc *pc, enum timing_cost cost, uint64_t cycles) {
+	timing->cycle += cycles;
+	pc->cycles[cost] += cycles;
+}
+
+// Registers an instruction reads, as a bit per register
+
+static uint32_t read_registers(Decoded_Instr *instr) {
+	uint32_t reads = 0;
+	uint32_t operand = instr->operand.op2;
+	bool shifted_reg = false;
+	switch (instr->type) {
+	case DATA_PROC:
+		reads = instr->opcode != OPCODE_MOV ? 1u << instr->rn : 0;
+		shifted_reg = !instr->imm;
+		break;
+	case MUL:
+		reads = 1u << instr->operand.mul.rm | 1u << instr->operand.mul.rs;
+		reads |= instr->accum ? 1u << instr->rn : 0;
+		break;
+	case TRANSFER:
+		reads = 1u << instr->rn | (instr->load ? 0 : 1u << instr->rd);
+		operand = instr->operand.offset;
+		shifted_reg = instr->imm;
+		break;
+	case MULTI_TRANSFER:
+		reads = 1u << instr->rn | (instr->load ? 0 : instr->operand.register_list);
+		break;
+	default:
+		break;
+	}
+	if (shifted_reg) {
+		reads |= 1u << (operand & RM_MASK);
+		reads |= operand & SHIFT_BY_REGISTER ? 1u << shift_register(operand) : 0;
+	}
+	return reads;
+}
+
+static bool writes_pc(Decoded_Instr *instr) {
+	switch (instr->type) {
+	case DATA_PROC:
+		return instr->rd == PC_REG && instr->opcode != OPCODE_TST && instr->opcode != OPCODE_TEQ
+		       && instr->opcode != OPCODE_CMP;
+	case TRANSFER:
+		return instr->load && instr->rd == PC_REG;
+	case MULTI_TRANSFER:
+		return instr->load && (instr->operand.register_list & (1 << PC_REG));
+	default:
+		return false;
+	}
+}
+
+// Bytes of the multiplier worked through, stopping early once the rest
+// are all sign bits
+
+static uint32_t multiply_bytes(uint32_t rs) {
+	uint32_t bytes = 1;
+	for (int shift = 8; shift < 32; shift += 8) {
+		int32_t rest = (int32_t) rs >> shift;
+		if (rest == 0 || rest == -1) {
+			break;
+		}
+		bytes++;
+	}
+	return bytes;
+}
+
+void timing_issue(Timing *timing, Machine *arm, uint32_t pc, Decoded_Instr *instr) {
+	Timing_Pc *counts = &timing->pcs[pc / 4];
+	timing->instructions++;
+	counts->executed++;
+	if (timing->block_ends) {
+		counts->leader = true;
+		timing->block_ends = false;
+	}
+	if (!cache_access(&timing->icache, pc >> timing->icache.line_shift)) {
+		counts->icache_misses++;
+		charge(timing, counts, COST_CACHE, timing->config.miss_penalty);
+	}
+	if (instr->conditional && !check_condition(arm, instr)) {
+		charge(timing, counts, COST_ISSUE, 1);
+		return;
+	}
+
+	uint64_t ready = timing->cycle;
+	for (uint32_t reads = read_registers(instr) & ~(1u << PC_REG); reads; reads &= reads - 1) {
+		uint64_t loaded = timing->ready[__builtin_ctz(reads)];
+		ready = loaded > ready ? loaded : ready;
+	}
+	charge(timing, counts, COST_INTERLOCK, ready - timing->cycle);
+	charge(timing, counts, COST_ISSUE, 1);
+
+	uint32_t list = instr->operand.register_list;
+	uint32_t registers = __builtin_popcount(list);
+	switch (instr->type) {
+	case MUL: {
+		uint8_t rs = instr->operand.mul.rs;
+		uint32_t value = rs == PC_REG ? arm->pc_reg : arm->general_reg[rs];
+		charge(timing, counts, COST_MULTIPLY, multiply_bytes(value) - 1 + instr->accum);
+		break;
+	}
+	case TRANSFER:
+		if (instr->load) {
+			timing->ready[instr->rd] = timing->cycle - 1 + TIMING_LOAD_LATENCY;
+		}
+		break;
+	case MULTI_TRANSFER:
+		if (registers > TIMING_REGISTERS_PER_BEAT) {
+			uint32_t beats = (registers + TIMING_REGISTERS_PER_BEAT - 1) / TIMING_REGISTERS_PER_BEAT;
+			charge(timing, counts, COST_TRANSFER, beats - 1);
+		}
+		for (; instr->load && list; list &= list - 1) {
+			timing->ready[__builtin_ctz(list)] = timing->cycle - 1 + TIMING_LOAD_LATENCY;
+		}
+		break;
+	default:
+		break;
+	}
+	if (writes_pc(instr)) {
+		charge(timing, counts, COST_BRANCH, timing->config.mispredict_penalty);
+		timing->block_ends = true;
+	}
+}
+
+// Block transfers touch every line of the range once
+
+void timing_data(Timing *timing, uint32_t pc, uint32_t address, uint32_t size) {
+	Timing_Pc *counts = &timing->pcs[pc / 4];
+	uint32_t first = address >> timing->dcache.line_shift;
+	uint32_t last = (address + size - 1) >> timing->dcache.line_shift;
+	for (uint32_t line = first; line <= last; line++) {
+		if (!cache_access(&timing->dcache, line)) {
+			counts->dcache_misses++;
+			charge(timing, counts, COST_CACHE, timing->config.miss_penalty);
+		}
+	}
+}
+
+void timing_branch(Timing *timing, uint32_t pc, bool taken) {
+	uint8_t *counter = &timing->counters[(pc / 4) & (timing->config.predictor_entries - 1)];
+	timing->branches++;
+	timing->block_ends = true;
+	if ((*counter >= 2) != taken) {
+		timing->mispredicts++;
+		timing->pcs[pc / 4].mispredicts++;
+		charge(timing, &timing->pcs[pc / 4], COST_BRANCH, timing->config.mispredict_penalty);
+	}
+	if (taken && *counter < 3) {
+		(*counter)++;
+	} else if (!taken && *counter > 0) {
+		(*counter)--;
+	}
+}
+
+uint64_t timing_cycles(const Timing *timing) {
+	return timing->cycle;
+}
+
+// --
+// -- Report
+// --
+
+static const char *cost_names[COSTS_NUM] = {
+	[COST_ISSUE] = "issue",
+	[COST_MULTIPLY] = "multiply",
+	[COST_TRANSFER] = "transfer",
+	[COST_INTERLOCK] = "interlock",
+	[COST_CACHE] = "cache",
+	[COST_BRANCH] = "branch"
+};
+
+struct Block {
+	uint32_t start;
+	uint32_t end;               // address after the last instruction
+	uint64_t entries;
+	uint64_t instructions;
+	uint64_t cycles[COSTS_NUM];
+	uint64_t total;
+};
+typedef struct Block Block;
+
+static uint64_t stall_cycles(const Timing_Pc *pc) {
+	return pc->cycles[COST_CACHE] + pc->cycles[COST_BRANCH];
+}
+
+static const Timing *sorted_timing;
+
+static int by_stalls(const void *a, const void *b) {
+	uint64_t stalls_a = stall_cycles(&sorted_timing->pcs[*(const uint32_t *) a]);
+	uint64_t stalls_b = stall_cycles(&sorted_timing->pcs[*(const uint32_t *) b]);
+	if (stalls_a != stalls_b) {
+		return stalls_a < stalls_b ? 1 : -1;
+	}
+	return *(const uint32_t *) a < *(const uint32_t *) b ? -1 : 1;
+}
+
+static int by_cycles(const void *a, const void *b) {
+	const Block *block_a = a;
+	const Block *block_b = b;
+	if (block_a->total != block_b->total) {
+		return block_a->total < block_b->total ? 1 : -1;
+	}
+	return block_a->start < block_b->start ? -1 : 1;
+}
+
+// Runs of executed instructions, split at every leader
+
+static uint32_t find_blocks(const Timing *timing, Block *blocks) {
+	uint32_t count = 0;
+	Block *block = NULL;
+	for (uint32_t i = 0; i < MEMORY_SIZE / 4; i++) {
+		const Timing_Pc *pc = &timing->pcs[i];
+		if (!pc->executed) {
+			block = NULL;
+			continue;
+		}
+		if (block == NULL || pc->leader) {
+			block = &blocks[count++];
+			memset(block, 0, sizeof(Block));
+			block->start = i * 4;
+			block->entries = pc->executed;
+		}
+		block->end = i * 4 + 4;
+		block->instructions += pc->executed;
+		for (int cost = 0; cost < COSTS_NUM; cost++) {
+			block->cycles[cost] += pc->cycles[cost];
+			block->total += pc->cycles[cost];
+		}
+	}
+	return count;
+}
+
+static void print_cache(const char *name, const Cache *cache, const Cache_Config *config, FILE *out) {
+	fprintf(out, "%s: %uKB %u-way %uB lines, %llu accesses, %llu misses", name, config->size / 1024,
+	        config->ways, config->line, (unsigned long long) cache->accesses,
+	        (unsigned long long) cache->misses);
+	if (cache->accesses) {
+		fprintf(out, " (%.2f%%)", 100.0 * cache->misses / cache->accesses);
+	}
+	fprintf(out, "\n");
+}
+
+static void print_blocks(const Timing *timing, FILE *out) {
+	Block *blocks = malloc(sizeof(Block) * MEMORY_SIZE / 4);
+	if (blocks == NULL) {
+		return;
+	}
+	uint32_t count = find_blocks(timing, blocks);
+	qsort(blocks, count, sizeof(Block), by_cycles);
+
+	fprintf(out, "%-21s %10s %12s %12s %8s", "block", "entries", "instructions", "cycles", "per-entry");
+	for (int cost = 0; cost < COSTS_NUM; cost++) {
+		fprintf(out, " %10s", cost_names[cost]);
+	}
+	fprintf(out, "\n");
+	for (uint32_t i = 0; i < count; i++) {
+		Block *block = &blocks[i];
+		fprintf(out, "0x%08x-0x%08x %10llu %12llu %12llu %8.1f", block->start, block->end - 4,
+		        (unsigned long long) block->entries, (unsigned long long) block->instructions,
+		        (unsigned long long) block->total, (double) block->total / block->entries);
+		for (int cost = 0; cost < COSTS_NUM; cost++) {
+			fprintf(out, " %10llu", (unsigned long long) block->cycles[cost]);
+		}
+		fprintf(out, "\n");
+	}
+	free(blocks);
+}
+
+static void print_stalls(const Timing *timing, FILE *out) {
+	uint32_t *order = malloc(sizeof(uint32_t) * MEMORY_SIZE / 4);
+	if (order == NULL) {
+		return;
+	}
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < MEMORY_SIZE / 4; i++) {
+		if (stall_cycles(&timing->pcs[i])) {
+			order[count++] = i;
+		}
+	}
+	sorted_timing = timing;
+	qsort(order, count, sizeof(uint32_t), by_stalls);
+
+	fprintf(out, "%-10s %10s %8s %8s %8s %10s\n", "pc", "executed", "i-miss", "d-miss", "mispred", "stalls");
+	for (uint32_t i = 0; i < count; i++) {
+		const Timing_Pc *pc = &timing->pcs[order[i]];
+		fprintf(out, "0x%08x %10llu %8u %8u %8u %10llu\n", order[i] * 4,
+		        (unsigned long long) pc->executed, pc->icache_misses, pc->dcache_misses,
+		        pc->mispredicts, (unsigned long long) stall_cycles(pc));
+	}
+	free(order);
+}
+
+void print_timing_report(const Timing *timing, FILE *out) {
+	fprintf(out, "Timing model:\n");
+	fprintf(out, "instructions: %llu\n", (unsigned long long) timing->instructions);
+	fprintf(out, "cycles:       %llu (estimated)", (unsigned long long) timing->cycle);
+	if (timing->instructions) {
+		fprintf(out, ", CPI %.2f", (double) timing->cycle / timing->instructions);
+	}
+	fprintf(out, "\n");
+	uint64_t totals[COSTS_NUM] = {0};
+	for (uint32_t i = 0; i < MEMORY_SIZE / 4; i++) {
+		for (int cost = 0; cost < COSTS_NUM; cost++) {
+			totals[cost] += timing->pcs[i].cycles[cost];
+		}
+	}
+	for (int cost = 0; cost < COSTS_NUM; cost++) {
+		fprintf(out, "%-13s %llu\n", cost_names[cost], (unsigned long long) totals[cost]);
+	}
+	print_cache("I-cache", &timing->icache, &timing->config.icache, out);
+	print_cache("D-cache", &timing->dcache, &timing->config.dcache, out);
+	fprintf(out, "Branches: %u entry predictor, %llu branches, %llu mispredicted\n",
+	        timing->config.predictor_entries, (unsigned long long) timing->branches,
+	        (unsigned long long) timing->mispredicts);
+	fprintf(out, "Basic blocks:\n");
+	print_blocks(timing, out);
+	fprintf(out, "Misses and mispredicts:\n");
+	print_stalls(timing, out);
+}
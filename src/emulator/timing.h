@@ -0,0 +1,146 @@
+#ifndef ARM11_18_TIMING_H
+#define ARM11_18_TIMING_H
+
+#include <stdio.h>
+#include "define_structures.h"
+
+// --
+// -- Guest performance model
+// --
+// Set-associative instruction and data caches and a branch predictor, fed
+// by the fetches, the loads and stores to guest memory and the outcome of
+// every branch, and an approximate ARM11 pipeline charging each
+// instruction its cycles as it issues:
+//
+//   - one to issue, conditions failing or not
+//   - multiplies one more for each byte of Rs beyond the first that is not
+//     just sign bits, and one more to accumulate
+//   - block transfers a beat for every two registers after the first beat
+//   - a register loaded is ready TIMING_LOAD_LATENCY cycles after the load
+//     issues, and instructions reading it earlier stall until then
+//   - cache misses and mispredicted branches their penalty, and writing
+//     the PC other than through a branch the refill of a mispredict
+//
+// Cycles are kept per instruction by cost and summed per basic block, a
+// block starting at each instruction reached right after a branch or a
+// write to the PC.
+//
+// The hooks are only built in with 'make TIMING=1', which defines
+// ARMEMU_TIMING; otherwise they expand to nothing and a Machine has no
+// model to attach. Device accesses and semihosting calls are not cached,
+// and nothing is fused while a model is attached, as fused groups skip
+// the fetches of the instructions they run.
+
+struct Cache_Config {
+	uint32_t size;          // bytes, all sizes powers of two
+	uint32_t line;          // bytes, 4 or more
+	uint32_t ways;
+};
+typedef struct Cache_Config Cache_Config;
+
+struct Timing_Config {
+	Cache_Config icache;
+	Cache_Config dcache;
+	uint32_t predictor_entries;     // 2 bit counters indexed by PC, a power of two
+	uint32_t miss_penalty;          // cycles per cache miss
+	uint32_t mispredict_penalty;    // cycles per mispredicted branch
+};
+typedef struct Timing_Config Timing_Config;
+
+// ARM1176JZF-S as on the Raspberry Pi: 16KB 4-way caches with 32 byte lines
+extern const Timing_Config timing_default_config;
+
+struct Cache {
+	uint32_t sets;
+	uint32_t ways;
+	uint8_t line_shift;
+	uint32_t *tags;         // line number + 1 per way, 0 when empty
+	uint64_t *used;         // last access per way, the lowest is evicted
+	uint64_t clock;
+	uint64_t accesses;
+	uint64_t misses;
+};
+typedef struct Cache Cache;
+
+#define TIMING_LOAD_LATENCY 3
+#define TIMING_REGISTERS_PER_BEAT 2
+
+// What cycles are spent on
+enum timing_cost {
+	COST_ISSUE,
+	COST_MULTIPLY,          // Rs bytes and accumulate
+	COST_TRANSFER,          // block transfer beats
+	COST_INTERLOCK,         // waiting for a load
+	COST_CACHE,             // cache misses
+	COST_BRANCH,            // refills
+	COSTS_NUM
+};
+
+// Counts for the instruction at one address
+struct Timing_Pc {
+	uint64_t executed;
+	uint32_t icache_misses;
+	uint32_t dcache_misses;
+	uint32_t mispredicts;
+	bool leader;            // a basic block starts here
+	uint64_t cycles[COSTS_NUM];
+};
+typedef struct Timing_Pc Timing_Pc;
+
+struct Timing {
+	Timing_Config config;
+	Cache icache;
+	Cache dcache;
+	uint8_t *counters;      // predictor, 0-1 predict not taken, 2-3 taken
+	uint64_t branches;
+	uint64_t mispredicts;
+	uint64_t instructions;
+	uint64_t cycle;                 // cycles so far, when the next instruction issues
+	uint64_t ready[PC_REG + 1];     // cycle each register's pending load completes
+	bool block_ends;                // the next instruction starts a basic block
+	Timing_Pc pcs[MEMORY_SIZE / 4];
+};
+typedef struct Timing Timing;
+
+// Allocate a model with empty caches. Returns NULL if the configuration
+// is invalid or out of memory.
+Timing *timing_create(const Timing_Config *config);
+
+void timing_destroy(Timing *timing);
+
+// Feed the model from 'arm' from now on, NULL to detach. Returns false if
+// the emulator was built without ARMEMU_TIMING.
+bool timing_attach(Timing *timing, Machine *arm);
+
+// Model events, 'pc' being the address of the instruction causing them.
+// An instruction is fetched and issued before it executes, with the
+// registers it reads still holding their operands.
+void timing_issue(Timing *timing, Machine *arm, uint32_t pc, Decoded_Instr *instr);
+
+void timing_data(Timing *timing, uint32_t pc, uint32_t address, uint32_t size);
+
+void timing_branch(Timing *timing, uint32_t pc, bool taken);
+
+uint64_t timing_cycles(const Timing *timing);
+
+// Totals, then the basic blocks and the instructions with misses or
+// mispredicts, the most cycles first
+void print_timing_report(const Timing *timing, FILE *out);
+
+#ifdef ARMEMU_TIMING
+#define TIMING_PC(arm) ((arm)->pc_reg - PIPELINE_OFFSET)
+#define TIMING_ATTACHED(arm) ((arm)->timing != NULL)
+#define TIMING_ISSUE(arm, address, instr) \
+	do { if ((arm)->timing) timing_issue((arm)->timing, arm, address, instr); } while (0)
+#define TIMING_DATA(arm, address, size) \
+	do { if ((arm)->timing) timing_data((arm)->timing, TIMING_PC(arm), address, size); } while (0)
+#define TIMING_BRANCH(arm, taken) \
+	do { if ((arm)->timing) timing_branch((arm)->timing, TIMING_PC(arm), taken); } while (0)
+#else
+#define TIMING_ATTACHED(arm) false
+#define TIMING_ISSUE(arm, address, instr) ((void) 0)
+#define TIMING_DATA(arm, address, size) ((void) 0)
+#define TIMING_BRANCH(arm, taken) ((void) 0)
+#endif
+
+#endif //ARM11_18_TIMING_H
@@ -0,0 +1,16377 @@
+mov r9,#0x1000
+mov r0,#0
+top:
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+eor r2,r2,r1
+orr r3,r3,r2
+sub r4,r4,#3
+mul r5,r1,r2
+mla r6,r1,r3,r6
+ldr r7,[r0,#4]
+cmp r1,r4
+addne r8,r8,#1
+movmi r7,r1
+add r1,r1,#1
+subs r9,r9,#1
+bne top
+andeq r0,r0,r0
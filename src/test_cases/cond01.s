@@ -0,0 +1,20 @@
+mov r0,#5
+mov r1,#7
+subs r2,r0,r1
+movmi r3,#1
+movpl r4,#1
+addcs r5,r5,#1
+addcc r6,r6,#1
+cmp r1,r0
+movhi r7,#1
+movls r8,#1
+muls r9,r0,r1
+mlaeqs r10,r0,r1,r9
+ldrne r11,=0x12345678
+streq r11,[r0]
+moveqs r12,#0
+bls skip
+lsls r1,#2
+skip:
+ldmeqfd sp!,{r0}
+andeq r0,r0,r0
@@ -0,0 +1,13 @@
+mov r0,#1
+mov r1,#5
+loop:
+mul r2,r0,r1
+mov r0,r2
+sub r1,r1,#1
+cmp r1,#0
+bgt loop
+mov r3,#0x100
+str r0,[r3]
+ldr r4,[r3,#0]
+str r4,[r3,#4]
+mov r5,r4,lsl r1
@@ -0,0 +1,12 @@
+mov r13,#0x8000
+ldr r3,[r13]
+cmp r3,#0
+bne leak
+mov r1,#5
+mov r2,#6
+stmfd sp!,{r1,r2}
+andeq r0,r0,r0
+leak:
+mov r4,#0x10000
+ldr r5,[r4]
+andeq r0,r0,r0
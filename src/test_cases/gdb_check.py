@@ -0,0 +1,194 @@
+"""GDB remote serial protocol check of 'emulate --gdb' on walk01.
+
+Starts the emulator on a TCP port and then on a Unix socket, and over
+each one goes through every packet the stub serves: the target
+description, registers, memory, breakpoints, write watchpoints, a
+debugger write into a watched range (which does not stop), no-ack mode,
+an interrupt and a run to the end.
+
+    make -C src/emulator
+    python3 src/test_cases/gdb_check.py src/emulator/emulate src/test_cases/walk01
+
+Prints the checks that fail and exits with 1, or prints the number of
+checks passed.
+"""
+
+import os
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+INTERRUPT = b'\x03'
+BREAKPOINT = 0x18       # the str in walk01
+WATCHED = 0x2154        # stored to on the sixth pass of the inner loop
+
+
+def checksum(data):
+    return '%02x' % (sum(data.encode('latin1')) & 0xff)
+
+
+class Connection:
+    def __init__(self, address):
+        for _ in range(100):
+            try:
+                if address.startswith(':'):
+                    self.sock = socket.create_connection(('127.0.0.1', int(address[1:])))
+                else:
+                    self.sock = socket.socket(socket.AF_UNIX)
+                    self.sock.connect(address)
+                break
+            except OSError:
+                time.sleep(0.05)
+        else:
+            raise OSError('cannot connect to ' + address)
+        self.input = b''
+        self.ack = True
+
+    def read_byte(self):
+        while not self.input:
+            data = self.sock.recv(65536)
+            if not data:
+                raise EOFError
+            self.input += data
+        byte, self.input = self.input[:1], self.input[1:]
+        return byte
+
+    def write(self, data, extra=b''):
+        self.sock.sendall(('$%s#%s' % (data, checksum(data))).encode('latin1') + extra)
+
+    # Send a packet and return the reply
+    def send(self, data, extra=b''):
+        self.write(data, extra)
+        if self.ack:
+            byte = self.read_byte()
+            if byte != b'+':
+                raise ValueError('expected an ack, got %r' % byte)
+        return self.receive()
+
+    def receive(self):
+        while self.read_byte() != b'$':
+            pass
+        data = b''
+        byte = self.read_byte()
+        while byte != b'#':
+            data += byte
+            byte = self.read_byte()
+        received = (self.read_byte() + self.read_byte()).decode()
+        data = data.decode('latin1')
+        if received != checksum(data):
+            raise ValueError('bad checksum on %r' % data)
+        if self.ack:
+            self.sock.sendall(b'+')
+        return data
+
+
+def words(reply):
+    return [struct.unpack('<I', bytes.fromhex(reply[i:i + 8]))[0] for i in range(0, len(reply), 8)]
+
+
+def word(value):
+    return struct.pack('<I', value).hex()
+
+
+class Checks:
+    def __init__(self):
+        self.passed = 0
+        self.failed = 0
+
+    def __call__(self, what, got, expected):
+        if got == expected:
+            self.passed += 1
+        else:
+            self.failed += 1
+            print('%s: got %r, expected %r' % (what, got, expected))
+
+
+def session(gdb, image, check):
+    gdb.send('qSupported:multiprocess+;swbreak+;xmlRegisters=arm')
+    xml = ''
+    while True:
+        reply = gdb.send('qXfer:features:read:target.xml:%x,100' % len(xml))
+        xml += reply[1:]
+        if reply[0] == 'l':
+            break
+    check('target.xml registers', xml.count('<reg '), 17)
+    check('?', gdb.send('?'), 'S05')
+    check('qAttached', gdb.send('qAttached'), '1')
+    check('Hg0', gdb.send('Hg0'), 'OK')
+    registers = words(gdb.send('g'))
+    check('g registers', len(registers), 17)
+    check('g pc', registers[15], 0)
+    check('m', gdb.send('m0,4'), image[:4].hex())
+    check('m outside memory', gdb.send('m10000,4'), 'E01')
+
+    check('Z0', gdb.send('Z0,%x,4' % BREAKPOINT), 'OK')
+    check('c to a breakpoint', gdb.send('c'), 'S05')
+    registers = words(gdb.send('g'))
+    check('pc at the breakpoint', registers[15], BREAKPOINT)
+    check('r1 at the breakpoint', registers[1], 0x2000)
+    check('sp at the breakpoint', registers[13], 0xfc00)
+    check('c to the breakpoint again', gdb.send('c'), 'S05')
+    check('r1 a pass later', words(gdb.send('g'))[1], 0x2044)
+    check('z0', gdb.send('z0,%x,4' % BREAKPOINT), 'OK')
+    check('s', gdb.send('s'), 'S05')
+    check('p pc after s', gdb.send('pf'), word(BREAKPOINT + 4))
+
+    check('Z2', gdb.send('Z2,%x,4' % WATCHED), 'OK')
+    check('c to a watchpoint', gdb.send('c'), 'T05watch:%x;' % WATCHED)
+    check('pc after the store', words(gdb.send('pf'))[0], BREAKPOINT + 4)
+    check('m stored', gdb.send('m%x,4' % WATCHED), word(WATCHED))
+    check('z2', gdb.send('z2,%x,4' % WATCHED), 'OK')
+    check('Z3 not supported', gdb.send('Z3,%x,4' % WATCHED), '')
+
+    check('Z2 on a debugger write', gdb.send('Z2,3000,4'), 'OK')
+    check('M', gdb.send('M3000,4:efbeadde'), 'OK')
+    check('m written', gdb.send('m3000,4'), 'efbeadde')
+    check('z2 on a debugger write', gdb.send('z2,3000,4'), 'OK')
+    check('P r5', gdb.send('P5=78563412'), 'OK')
+    check('p r5', gdb.send('p5'), '78563412')
+    check('p cpsr', len(gdb.send('p19')), 8)
+    check('p no such register', gdb.send('p10'), 'E01')
+
+    check('QStartNoAckMode', gdb.send('QStartNoAckMode'), 'OK')
+    gdb.ack = False
+    # the interrupt is read with the continue, and stops it at the first check
+    check('c interrupted', gdb.send('c', INTERRUPT), 'S02')
+    check('c to the end', gdb.send('c'), 'W00')
+    gdb.write('k')
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('usage: gdb_check.py emulate image')
+        return 1
+    emulate, image_path = sys.argv[1:]
+    with open(image_path, 'rb') as file:
+        image = file.read()
+    check = Checks()
+
+    with socket.socket() as probe:
+        probe.bind(('127.0.0.1', 0))
+        port = probe.getsockname()[1]
+    with tempfile.TemporaryDirectory() as directory:
+        for address in [':%d' % port, os.path.join(directory, 'gdb.sock')]:
+            emulator = subprocess.Popen([emulate, '--gdb=' + address, image_path])
+            try:
+                session(Connection(address), image, check)
+                check('exit status on ' + address, emulator.wait(timeout=60), 0)
+            finally:
+                if emulator.poll() is None:
+                    emulator.kill()
+                    emulator.wait()
+
+    if check.failed:
+        print('%d of %d checks failed' % (check.failed, check.passed + check.failed))
+        return 1
+    print('%d checks passed' % check.passed)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,19 @@
+mov r13,#0x200
+mov r5,#3
+mov r12,#0x10
+mov r8,#0
+top:
+subs r5,r5,#1
+beq done
+add r8,r8,#1
+stmfd sp!,{r5,r12}
+ldmfd sp!,{r7,r15}
+mov r9,#1
+done:
+mov r10,#0x3c
+stmfd sp!,{r10}
+mov r12,#0
+ldmfd sp!,{r15}
+mov r9,#2
+mov r11,#7
+andeq r0,r0,r0
@@ -0,0 +1,14 @@
+mov r1,#0xff
+lsl r1,#16
+mov r2,#0
+loop:
+sub r1,r1,#5
+cmp r1,#0
+bne loop
+mov r3,#0xff
+lsl r3,#8
+count:
+subs r3,r3,#3
+bpl count
+mov r2,#1
+andeq r0,r0,r0
@@ -0,0 +1,18 @@
+mov r0,#10
+mov r1,#0
+ldr r4,=0x20200000
+ldr r5,=0x12345
+loop:
+add r1,r1,r0
+sub r0,r0,#1
+cmp r0,#0
+bne loop
+mov r2,#0x100
+str r1,[r2]
+ldr r3,[r2]
+mul r6,r1,r3
+mla r7,r1,r3,r6
+bge skip
+mov r8,#1
+skip:
+andeq r0,r0,r0
@@ -0,0 +1,3 @@
+mov r0,#0
+muls r1,r0,r0
+andeq r0,r0,r0
@@ -0,0 +1,10 @@
+mov r13,#0x400
+mov r1,#0
+mov r2,#5
+loop:
+add r1,r1,#1
+stmfd sp!,{r1,r2}
+ldmfd sp!,{r3,r4}
+subs r2,r2,#1
+bne loop
+andeq r0,r0,r0
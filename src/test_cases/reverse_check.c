@@ -0,0 +1,153 @@
+// Reverse execution (src/emulator/reverse.h) against fresh runs: the
+// image is run to its end with checkpoints, then taken back and forth to
+// pseudo-random steps and stepped back one at a time from the end, each
+// state compared with a plain run of that many steps. reverse-continue is
+// compared with a scan a step at a time, to the last change of a watched
+// register and to the last breakpoint hit. All of it is done with the
+// default interval and budget, and with a small interval in the smallest
+// budget, which makes the checkpoints thin out over and over.
+//
+//     make -C src/emulator clean && make -C src/emulator REVERSE=1 libarmemu.a
+//     cc -O2 -std=c99 -I src/emulator src/test_cases/reverse_check.c src/emulator/libarmemu.a -pthread -o reverse_check
+//     ./reverse_check src/test_cases/walk01
+//
+// walk01 stores over 48 pages and pushes a word in each pass, in 10M
+// steps. Prints the checks that fail and exits with 1, or prints the
+// number of checks passed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "armemu.h"
+#include "reverse.h"
+
+#define GOTOS 40
+#define STEPS_BACK 100
+#define WATCHED_REGISTER 1
+#define BREAKPOINT 0x1c         // the push in walk01
+
+static uint8_t image[1 << 16];
+static size_t image_length;
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+static void check(bool passed, const char *what, uint64_t step) {
+	checks++;
+	if (!passed) {
+		failures++;
+		printf("%s: step %llu\n", what, (unsigned long long) step);
+	}
+}
+
+// -- Reference runs
+
+// 'arm' loaded afresh and run 'steps' instructions
+static armemu_machine *run_to(armemu_machine *arm, uint64_t steps) {
+	armemu_load(arm, image, image_length);
+	armemu_step(arm, steps);
+	return arm;
+}
+
+static bool same_state(armemu_machine *a, armemu_machine *b) {
+	size_t size;
+	uint8_t *memory = armemu_memory(a, &size);
+	return memcmp(memory, armemu_memory(b, NULL), size) == 0
+	       && memcmp(armemu_registers(a), armemu_registers(b), 15 * sizeof(uint32_t)) == 0
+	       && armemu_pc(a) == armemu_pc(b) && armemu_cpsr(a) == armemu_cpsr(b)
+	       && armemu_steps(a) == armemu_steps(b) && armemu_halted(a) == armemu_halted(b);
+}
+
+// The last step before 'before' after which the watched register had
+// changed, or the breakpoint was next, 0 if none
+static uint64_t scan_back(armemu_machine *ref, uint64_t before, bool watch) {
+	armemu_load(ref, image, image_length);
+	uint64_t last = 0;
+	uint32_t previous = armemu_registers(ref)[WATCHED_REGISTER];
+	while (armemu_steps(ref) < before - 1) {
+		armemu_step(ref, 1);
+		uint32_t value = armemu_registers(ref)[WATCHED_REGISTER];
+		if (watch ? value != previous : armemu_pc(ref) - 8 == BREAKPOINT) {
+			last = armemu_steps(ref);
+		}
+		previous = value;
+	}
+	return last;
+}
+
+// -- Checks
+
+static void check_history(armemu_machine *arm, armemu_machine *ref, const Reverse_Config *config) {
+	armemu_load(arm, image, image_length);
+	Reverse *reverse = reverse_create(config);
+	if (!reverse || !reverse_attach(reverse, arm)) {
+		puts("out of memory, or the library was built without REVERSE=1");
+		exit(EXIT_FAILURE);
+	}
+	reverse_forward(reverse, UINT64_MAX);
+	uint64_t total = armemu_steps(arm);
+	armemu_load(ref, image, image_length);
+	armemu_run(ref);
+	check(same_state(arm, ref), "run to the end", total);
+
+	uint32_t state = 0x12345678;
+	for (int i = 0; i < GOTOS; i++) {
+		state = state * 1664525 + 1013904223;
+		uint64_t step = (uint64_t) state * (total + 1) >> 32;
+		reverse_goto(reverse, step);
+		check(same_state(arm, run_to(ref, step)), "goto", step);
+	}
+
+	reverse_goto(reverse, total);
+	for (int i = 1; i <= STEPS_BACK; i++) {
+		reverse_back(reverse, 1);
+	}
+	check(same_state(arm, run_to(ref, total - STEPS_BACK)), "reverse-step", total - STEPS_BACK);
+
+	uint64_t middle = total / 2 + 12345;
+	reverse_watch(reverse, WATCHED_REGISTER);
+	reverse_goto(reverse, middle);
+	enum reverse_stop stop = reverse_continue_back(reverse);
+	check(stop == REVERSE_WATCH && armemu_steps(arm) == scan_back(ref, middle, true),
+	      "reverse-continue to a watched change", middle);
+	reverse_watch(reverse, REVERSE_NO_WATCH);
+
+	reverse_break(reverse, BREAKPOINT, true);
+	reverse_goto(reverse, middle);
+	stop = reverse_continue_back(reverse);
+	check(stop == REVERSE_BREAKPOINT && armemu_steps(arm) == scan_back(ref, middle, false)
+	      && same_state(arm, run_to(ref, armemu_steps(arm))), "reverse-continue to a breakpoint", middle);
+	reverse_destroy(reverse);
+}
+
+int main(int argc, char **argv) {
+	FILE *file = argc == 2 ? fopen(argv[1], "rb") : NULL;
+	if (!file) {
+		puts("usage: reverse_check image");
+		return EXIT_FAILURE;
+	}
+	image_length = fread(image, 1, sizeof(image), file);
+	fclose(file);
+
+	armemu_machine *arm = armemu_create();
+	armemu_machine *ref = armemu_create();
+	if (!arm || !ref) {
+		puts("out of memory");
+		return EXIT_FAILURE;
+	}
+	const Reverse_Config configs[] = {
+		{REVERSE_DEFAULT_INTERVAL, REVERSE_DEFAULT_BUDGET},
+		{100, REVERSE_MIN_BUDGET}
+	};
+	for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+		check_history(arm, ref, &configs[i]);
+	}
+	armemu_destroy(arm);
+	armemu_destroy(ref);
+	if (failures) {
+		printf("%u of %u checks failed\n", failures, checks);
+		return EXIT_FAILURE;
+	}
+	printf("%u checks passed\n", checks);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,22 @@
+b _start
+table:
+.space 2048
+_start:
+mov r1,#1
+lsl r1,#12
+ldr r5,[r1]
+mov r7,#8
+ldr r6,[r7]
+mov r2,#0x11
+mov r0,#0
+fill:
+str r2,[r1]
+add r1,r1,#4
+add r2,r2,#0x11
+add r0,r0,#1
+cmp r0,#8
+bne fill
+ldr r3,[r1,#-4]
+ldr r4,[r1,#-32]
+andeq r0,r0,r0
+.space 2048
@@ -0,0 +1,27 @@
+mov r0,#0x100
+mov r1,#0x5a
+mov r2,#8
+memset
+mov r0,#0x108
+mov r1,#0xa5
+mov r2,#8
+memset
+mov r0,#0x104
+mov r1,#0x100
+mov r2,#12
+memcpy
+mov r0,#0x108
+mov r1,#0x10c
+mov r2,#4
+memcmp
+mov r4,r0
+mov r0,#0x10c
+mov r1,#0x100
+mov r2,#4
+swi #3
+mov r5,r0
+mov r0,#0x100
+mov r1,#16
+swi #4
+mov r6,r0
+andeq r0,r0,r0
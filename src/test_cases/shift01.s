@@ -0,0 +1,31 @@
+mov r2,#1
+lsl r2,#8
+mov r3,#24
+mov r6,#1
+lsl r6,#31
+mov r7,#40
+mov r11,#0xe
+lsl r11,#28
+mov r12,#0x70
+ldr r0,=0x01b01312
+orr r0,r0,r11
+str r0,[r12]
+ldr r0,=0x23a04001
+str r0,[r12,#4]
+ldr r0,=0x01b05756
+orr r0,r0,r11
+str r0,[r12,#8]
+ldr r0,=0x23a08001
+str r0,[r12,#12]
+ldr r0,=0x01b09062
+orr r0,r0,r11
+str r0,[r12,#16]
+ldr r0,=0x33a0a001
+str r0,[r12,#20]
+ldr r0,=0x01b0b026
+orr r0,r0,r11
+str r0,[r12,#24]
+b run
+run:
+.space 32
+andeq r0,r0,r0
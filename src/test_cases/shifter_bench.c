@@ -0,0 +1,141 @@
+// Throughput of the barrel shifter in src/emulator/shifter.h against the
+// switch based one it replaced, copied below as it was before, over the
+// same pseudo-random shifts of every type by 1 to 31 (the amounts the old
+// one handled). Two loops are timed for each: a chain, each shift taking
+// the last result and carry, bound by latency, and independent shifts
+// summed, bound by throughput.
+//
+//     cc -O2 -std=c99 -I src/emulator src/test_cases/shifter_bench.c -o shifter_bench
+//     ./shifter_bench
+//
+// Prints the best of ROUNDS timings of each loop in ns per shift, old then
+// new.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "shifter.h"
+
+#define SHIFTS (1 << 20)
+#define ROUNDS 11
+
+// -- The shifter before
+
+static inline uint32_t old_shift_value(uint32_t to_shift, uint8_t ammount, uint8_t type, uint8_t *carry) {
+	if (ammount == 0) {
+		*carry = 0;
+		return to_shift;
+	}
+	switch (type) {
+	case 0:         // logical left
+		if (ammount >= 32) {
+			*carry = 0;
+			return 0;
+		} else {
+			*carry = (0x1u << (32 - ammount)) & to_shift;
+			return to_shift << ammount;
+		}
+	case 1:         //logical right
+		if (ammount >= 32) {
+			*carry = 0;
+			return 0;
+		} else {
+			*carry = (0x1u << (ammount - 1)) & to_shift;
+			return to_shift >> ammount;
+		}
+	case 2:         // arithmetic right
+		if (ammount >= 32) {
+			if (to_shift >> 31) {
+				return 0xffffffff;
+			} else {
+				return 0;
+			}
+		} else {
+			*carry = (0x1u << (ammount - 1)) & to_shift;
+			if (to_shift >> 31) {
+				uint32_t bottom = to_shift >> ammount;
+				uint32_t top = 0xffffffff << (32 - ammount);
+				return top | bottom;
+			} else {
+				return to_shift >> ammount;
+			}
+		}
+	case 3:         // rotate right
+		ammount = ammount % 32;
+		*carry = (0x1u << (ammount - 1)) & to_shift;
+		uint32_t bottom = to_shift >> ammount;
+		uint8_t offset = 32 - ammount;
+		uint32_t top = (to_shift << offset);
+		return top | bottom;
+	default:
+		return 0;
+	}
+}
+
+// -- Timing
+
+static uint32_t values[SHIFTS];
+static uint8_t amounts[SHIFTS];
+static uint8_t types[SHIFTS];
+
+// Keeps the results live
+static volatile uint32_t sink;
+
+static double now_ns(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+#define TIME_LOOP(best, body)                                   \
+	do {                                                    \
+		best = 1e30;                                    \
+		for (int round = 0; round < ROUNDS; round++) {  \
+			double start = now_ns();                \
+			body                                    \
+			double ns = (now_ns() - start) / SHIFTS; \
+			best = ns < best ? ns : best;           \
+		}                                               \
+	} while (0)
+
+#define CHAIN(shift)                                                            \
+	{                                                                       \
+		uint32_t last = 0;                                              \
+		uint8_t carry = 0;                                              \
+		for (uint32_t i = 0; i < SHIFTS; i++) {                         \
+			last = shift(values[i] ^ last, amounts[i] + (carry != 0), types[i], &carry); \
+		}                                                               \
+		sink = last;                                                    \
+	}
+
+#define INDEPENDENT(shift)                                                      \
+	{                                                                       \
+		uint32_t sum = 0;                                               \
+		for (uint32_t i = 0; i < SHIFTS; i++) {                         \
+			uint8_t carry = 0;                                      \
+			sum += shift(values[i], amounts[i], types[i], &carry) + carry; \
+		}                                                               \
+		sink = sum;                                                     \
+	}
+
+int main(void) {
+	uint32_t state = 0x12345678;
+	for (uint32_t i = 0; i < SHIFTS; i++) {
+		state = state * 1664525 + 1013904223;
+		values[i] = state;
+		state = state * 1664525 + 1013904223;
+		amounts[i] = 1 + (state >> 24) % 30;    // <- 1 - 30, up to 31 with a carry added
+		types[i] = state >> 30;
+	}
+
+	double old_chain, new_chain, old_independent, new_independent;
+	TIME_LOOP(old_chain, CHAIN(old_shift_value));
+	TIME_LOOP(new_chain, CHAIN(shift_value));
+	TIME_LOOP(old_independent, INDEPENDENT(old_shift_value));
+	TIME_LOOP(new_independent, INDEPENDENT(shift_value));
+	printf("chain       : %.2f vs %.2f ns per shift\n", old_chain, new_chain);
+	printf("independent : %.2f vs %.2f ns per shift\n", old_independent, new_independent);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+// Exhaustive check of the barrel shifter in src/emulator/shifter.h against
+// a plain transcription of the ARM ARM shifter operand rules: every shift
+// type, every register amount 0-255 and immediate amount 0-31, both carries
+// in, over edge values and pseudo-random ones.
+//
+//     cc -O2 -std=c99 -I src/emulator src/test_cases/shifter_check.c -o shifter_check
+//     ./shifter_check
+//
+// Prints the first mismatches and exits with 1, or prints the number of
+// cases checked.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "shifter.h"
+
+#define VALUES 2000
+#define MAX_MISMATCHES 10
+
+// -- Reference
+
+static uint32_t bit(uint32_t value, uint32_t n) {
+	return (value >> n) & 1;
+}
+
+// Shift by the bottom byte of Rs
+static uint32_t reference_register(uint32_t value, uint32_t amount, uint8_t type, uint8_t *carry) {
+	uint32_t rotate = amount & 31;
+	if (amount == 0) {
+		return value;
+	}
+	switch (type) {
+	case LOGICAL_LEFT:
+		if (amount < 32) {
+			*carry = bit(value, 32 - amount);
+			return value << amount;
+		}
+		*carry = amount == 32 ? bit(value, 0) : 0;
+		return 0;
+	case LOGICAL_RIGHT:
+		if (amount < 32) {
+			*carry = bit(value, amount - 1);
+			return value >> amount;
+		}
+		*carry = amount == 32 ? bit(value, 31) : 0;
+		return 0;
+	case ARITHM_RIGHT:
+		if (amount < 32) {
+			*carry = bit(value, amount - 1);
+			return bit(value, 31) ? ~(~value >> amount) : value >> amount;
+		}
+		*carry = bit(value, 31);
+		return bit(value, 31) ? 0xffffffff : 0;
+	default:
+		if (rotate == 0) {
+			*carry = bit(value, 31);
+			return value;
+		}
+		*carry = bit(value, rotate - 1);
+		return value >> rotate | value << (32 - rotate);
+	}
+}
+
+// Shift by the 5 bit amount of an instruction
+static uint32_t reference_immediate(uint32_t value, uint32_t amount, uint8_t type, uint8_t *carry) {
+	if (amount != 0) {
+		return reference_register(value, amount, type, carry);
+	}
+	switch (type) {
+	case LOGICAL_LEFT:
+		return value;
+	case LOGICAL_RIGHT:
+	case ARITHM_RIGHT:
+		return reference_register(value, 32, type, carry);
+	default: {      // RRX
+		uint32_t extended = (uint32_t) *carry << 31 | value >> 1;
+		*carry = bit(value, 0);
+		return extended;
+	}
+	}
+}
+
+// -- Comparison
+
+static uint32_t mismatches = 0;
+
+static void compare(const char *kind, uint32_t value, uint32_t amount, uint8_t type, uint8_t carry_in,
+                    uint32_t result, uint8_t carry, uint32_t expected, uint8_t expected_carry) {
+	if (result == expected && carry == expected_carry) {
+		return;
+	}
+	if (mismatches++ < MAX_MISMATCHES) {
+		printf("%s type %u by %u of 0x%08x, C %u: got 0x%08x C %u, expected 0x%08x C %u\n",
+		       kind, type, amount, value, carry_in, result, carry, expected, expected_carry);
+	}
+}
+
+static uint32_t next_value(uint32_t i) {
+	static const uint32_t edges[] = {
+		0, 1, 2, 0x7f, 0x80, 0xff, 0x100, 0x7fffffff, 0x80000000, 0x80000001,
+		0xfffffffe, 0xffffffff, 0xaaaaaaaa, 0x55555555, 0x0000ff00, 0x00ff0000
+	};
+	static uint32_t state = 0x12345678;
+	if (i < sizeof(edges) / sizeof(edges[0])) {
+		return edges[i];
+	}
+	state = state * 1664525 + 1013904223;
+	return state;
+}
+
+int main(void) {
+	uint64_t cases = 0;
+	for (uint32_t i = 0; i < VALUES; i++) {
+		uint32_t value = next_value(i);
+		for (uint8_t type = LOGICAL_LEFT; type <= ROTATE_RIGHT; type++) {
+			for (uint8_t carry_in = 0; carry_in <= 1; carry_in++) {
+				// Rs is r1 holding junk above its bottom byte, Rm is r2
+				for (uint32_t amount = 0; amount < 256; amount++) {
+					uint32_t operand = 1 << 8 | type << 5 | SHIFT_BY_REGISTER | 2;
+					uint8_t carry = carry_in;
+					uint8_t expected_carry = carry_in;
+					uint32_t result = shift_operand(operand, value, 0xabcd00 | amount, &carry);
+					uint32_t expected = reference_register(value, amount, type, &expected_carry);
+					compare("register", value, amount, type, carry_in, result, carry, expected, expected_carry);
+					cases++;
+				}
+				for (uint32_t amount = 0; amount < 32; amount++) {
+					uint32_t operand = amount << 7 | type << 5 | 2;
+					uint8_t carry = carry_in;
+					uint8_t expected_carry = carry_in;
+					uint32_t result = shift_operand(operand, value, 0, &carry);
+					uint32_t expected = reference_immediate(value, amount, type, &expected_carry);
+					compare("immediate", value, amount, type, carry_in, result, carry, expected, expected_carry);
+					cases++;
+				}
+			}
+		}
+	}
+	if (mismatches) {
+		printf("%u of %llu cases differ\n", mismatches, (unsigned long long) cases);
+		return EXIT_FAILURE;
+	}
+	printf("%llu cases agree\n", (unsigned long long) cases);
+	return EXIT_SUCCESS;
+}
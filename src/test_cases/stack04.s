@@ -0,0 +1,5 @@
+mov r0,#0x01
+mov r1,#0x20
+mov r3,#0x10
+stmfd sp!,{r0,r1,r3}
+ldmfd sp!,{r4,r5,r6}
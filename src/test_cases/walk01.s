@@ -0,0 +1,18 @@
+ldr r13,=0xfc00
+mov r0,#0
+ldr r9,=2000
+outer:
+ldr r1,=0x2000
+ldr r2,=0xe000
+inner:
+add r3,r0,r1
+str r3,[r1]
+stmfd sp!,{r0,r1,r2,r3}
+ldmfd sp!,{r0,r1,r2,r3}
+add r1,r1,#0x44
+cmp r1,r2
+blt inner
+add r0,r0,#1
+cmp r0,r9
+blt outer
+andeq r0,r0,r0
@@ -0,0 +1,226 @@
+// Breakpoints and watchpoints of libarmemu against every kind of store:
+// a single str, a block store the registers of which are not contiguous,
+// a contiguous one written as a single copy, and a push. Each
+// watch is tried on every byte of the words stored, then against writes
+// from the host, which no watchpoint sees, and against a store over the
+// word a breakpoint is on, which keeps it. Stops at a breakpoint in a
+// loop, and steps run from it, are compared with runs without one.
+//
+//     make -C src/emulator libarmemu.a
+//     cc -O2 -std=c99 -I src/emulator src/test_cases/watch_check.c src/emulator/libarmemu.a -pthread -o watch_check
+//     ./watch_check
+//
+// Prints the checks that fail and exits with 1, or prints the number of
+// checks passed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "armemu.h"
+
+// Stored to, well above the programs and their stack limit
+#define TARGET 0x200
+#define STACK_TOP 0x400
+
+#define HALT 0x00000000
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+static void check(bool passed, const char *what, uint32_t address, uint32_t length) {
+	checks++;
+	if (!passed) {
+		failures++;
+		printf("%s: 0x%x, %u bytes\n", what, address, length);
+	}
+}
+
+static void load(armemu_machine *arm, const uint32_t *program, size_t words) {
+	if (!armemu_load(arm, (const uint8_t *) program, words * sizeof(uint32_t))) {
+		printf("cannot load a %zu word program\n", words);
+		exit(EXIT_FAILURE);
+	}
+	uint32_t *reg = armemu_registers(arm);
+	reg[0] = TARGET;
+	reg[1] = 0x11111111;
+	reg[2] = 0x22222222;
+	reg[3] = 0x33333333;
+	reg[13] = STACK_TOP;
+}
+
+// -- Guest stores
+
+typedef struct {
+	const char *name;
+	uint32_t instruction;
+	uint32_t start;             // first byte stored
+	uint32_t length;            // bytes stored
+} Store;
+
+// The block stores land where the emulator puts them: stmia from base + 4,
+// and stmfd sp! from sp - 4 up to sp + 4
+static const Store stores[] = {
+	{"str",           0xe5801000, TARGET, 4},              // str r1, [r0]
+	{"stmia {r1,r3}", 0xe880000a, TARGET + 4, 8},          // stmia r0, {r1, r3}
+	{"stmia {r1-r3}", 0xe880000e, TARGET + 4, 12},         // stmia r0, {r1, r2, r3}
+	{"stmfd sp!",     0xe92d0006, STACK_TOP - 4, 8}        // stmfd sp!, {r1, r2}
+};
+
+// Every watch of 1, 2 or 4 bytes starting on a word the store reaches or
+// the words either side of it stops the run after the store exactly when
+// it overlaps the bytes stored, at the first watched byte stored
+static void check_store(armemu_machine *arm, const Store *store) {
+	const uint32_t program[] = {store->instruction, HALT};
+	uint32_t first = (store->start & ~3u) - 4;
+	uint32_t last = ((store->start + store->length + 3) & ~3u) + 4;
+	for (uint32_t address = first; address < last; address++) {
+		for (uint32_t length = 1; length <= 4; length *= 2) {
+			load(arm, program, 2);
+			armemu_set_watchpoint(arm, address, length);
+			armemu_run(arm);
+			armemu_clear_watchpoint(arm, address, length);
+			bool overlaps = address < store->start + store->length && store->start < address + length;
+			uint32_t hit = address > store->start ? address : store->start;
+			if (overlaps) {
+				check(armemu_fault(arm) == ARMEMU_WATCHPOINT && armemu_fault_address(arm) == hit
+				      && armemu_pc(arm) - 8 == 4 && armemu_steps(arm) == 1, store->name, address, length);
+			} else {
+				check(armemu_fault(arm) == ARMEMU_OK && armemu_halted(arm), store->name, address, length);
+			}
+		}
+	}
+}
+
+// -- Host writes
+
+// Neither a write followed by armemu_invalidate() nor a reload over a
+// watched range stops the run; the guest store after them does
+static void check_host_writes(armemu_machine *arm) {
+	const uint32_t program[] = {0xe5801000, HALT};      // str r1, [r0]
+	load(arm, program, 2);
+	armemu_set_watchpoint(arm, TARGET, 4);
+	uint8_t *memory = armemu_memory(arm, NULL);
+	memset(&memory[TARGET], 0xff, 4);
+	armemu_invalidate(arm, TARGET, 4);
+	check(armemu_fault(arm) == ARMEMU_OK, "host write", TARGET, 4);
+	armemu_clear_watchpoint(arm, TARGET, 4);
+	armemu_set_watchpoint(arm, 0, 4);
+	armemu_reload(arm, (const uint8_t *) program, sizeof(program));
+	check(armemu_fault(arm) == ARMEMU_OK, "reload", 0, 4);
+	armemu_clear_watchpoint(arm, 0, 4);
+	armemu_set_watchpoint(arm, TARGET, 4);
+	armemu_registers(arm)[0] = TARGET;
+	armemu_run(arm);
+	check(armemu_fault(arm) == ARMEMU_WATCHPOINT && armemu_fault_address(arm) == TARGET,
+	      "store after host writes", TARGET, 4);
+	armemu_clear_watchpoint(arm, TARGET, 4);
+}
+
+// -- Breakpoints
+
+// A program copying the word a breakpoint is on over itself, by str and
+// by a block store, still stops there, and goes on to halt once cleared
+static void check_breakpoint_kept(armemu_machine *arm) {
+	const uint32_t program[] = {
+		0xe3a00018,             // mov r0, #0x18
+		0xe5901004,             // ldr r1, [r0, #4]
+		0xe5801004,             // str r1, [r0, #4]
+		0xe8900006,             // ldmia r0, {r1, r2}
+		0xe8800006,             // stmia r0, {r1, r2}
+		0xe1a00000,             // mov r0, r0
+		0xe1a00000,             // mov r0, r0
+		0xe3a03002,             // mov r3, #2       at 0x1c
+		HALT
+	};
+	load(arm, program, 9);
+	armemu_set_breakpoint(arm, 0x1c);
+	armemu_run(arm);
+	check(armemu_fault(arm) == ARMEMU_BREAKPOINT && armemu_pc(arm) - 8 == 0x1c && armemu_steps(arm) == 7,
+	      "breakpoint stored over", 0x1c, 4);
+	armemu_clear_breakpoint(arm, 0x1c);
+	armemu_run(arm);
+	check(armemu_halted(arm) && armemu_fault(arm) == ARMEMU_OK && armemu_registers(arm)[3] == 2,
+	      "run on from the breakpoint", 0x1c, 4);
+}
+
+// Memory and registers; a stop at a breakpoint ends the run as a halt
+// does, so whether it halted is left out
+static bool same_state(armemu_machine *a, armemu_machine *b) {
+	size_t size;
+	uint8_t *memory = armemu_memory(a, &size);
+	return memcmp(memory, armemu_memory(b, NULL), size) == 0
+	       && memcmp(armemu_registers(a), armemu_registers(b), 15 * sizeof(uint32_t)) == 0
+	       && armemu_pc(a) == armemu_pc(b) && armemu_cpsr(a) == armemu_cpsr(b)
+	       && armemu_steps(a) == armemu_steps(b);
+}
+
+// A loop storing a countdown, the subs and bne of which are fused
+static const uint32_t countdown[] = {
+	0xe3a00c02,             // mov r0, #0x200
+	0xe3a02005,             // mov r2, #5
+	0xe5802000,             // str r2, [r0]     at 0x8
+	0xe2800004,             // add r0, r0, #4
+	0xe2522001,             // subs r2, r2, #1
+	0x1afffffb,             // bne 0x8
+	HALT
+};
+
+// 'ref' loaded afresh and run 'steps' instructions, with no points set
+static armemu_machine *run_to(armemu_machine *ref, uint64_t steps) {
+	armemu_load(ref, (const uint8_t *) countdown, sizeof(countdown));
+	armemu_step(ref, steps);
+	return ref;
+}
+
+// Each stop at a breakpoint, steps run from one and into the next, the
+// breakpoint kept by a load, and the final state once cleared are the
+// state a run without points has after as many steps
+static void check_breakpoint_runs(armemu_machine *arm, armemu_machine *ref) {
+	armemu_load(arm, (const uint8_t *) countdown, sizeof(countdown));
+	armemu_set_breakpoint(arm, 0x8);
+	for (int pass = 0; pass < 5; pass++) {
+		armemu_run(arm);
+		check(armemu_fault(arm) == ARMEMU_BREAKPOINT && armemu_pc(arm) - 8 == 0x8
+		      && armemu_steps(arm) == 2 + 4 * (uint64_t) pass
+		      && same_state(arm, run_to(ref, armemu_steps(arm))), "breakpoint stop", 0x8, 4);
+	}
+	armemu_load(arm, (const uint8_t *) countdown, sizeof(countdown));
+	armemu_run(arm);
+	uint64_t ran = armemu_step(arm, 3);
+	check(ran == 3 && same_state(arm, run_to(ref, 5)), "step from a breakpoint", 0x8, 4);
+	ran = armemu_step(arm, 6);
+	check(ran == 1 && armemu_fault(arm) == ARMEMU_BREAKPOINT && same_state(arm, run_to(ref, 6)),
+	      "step into a breakpoint", 0x8, 4);
+	armemu_load(arm, (const uint8_t *) countdown, sizeof(countdown));
+	armemu_run_limited(arm, 1000, 0);
+	check(armemu_fault(arm) == ARMEMU_BREAKPOINT && armemu_steps(arm) == 2
+	      && same_state(arm, run_to(ref, 2)), "breakpoint kept by a load", 0x8, 4);
+	armemu_clear_breakpoint(arm, 0x8);
+	armemu_run(arm);
+	armemu_load(ref, (const uint8_t *) countdown, sizeof(countdown));
+	armemu_run(ref);
+	check(armemu_fault(arm) == ARMEMU_OK && armemu_halted(arm) && same_state(arm, ref), "run on to the end", 0x8, 4);
+}
+
+int main(void) {
+	armemu_machine *arm = armemu_create();
+	armemu_machine *ref = armemu_create();
+	if (!arm || !ref) {
+		puts("out of memory");
+		return EXIT_FAILURE;
+	}
+	for (size_t i = 0; i < sizeof(stores) / sizeof(stores[0]); i++) {
+		check_store(arm, &stores[i]);
+	}
+	check_host_writes(arm);
+	check_breakpoint_kept(arm);
+	check_breakpoint_runs(arm, ref);
+	armemu_destroy(arm);
+	armemu_destroy(ref);
+	if (failures) {
+		printf("%u of %u checks failed\n", failures, checks);
+		return EXIT_FAILURE;
+	}
+	printf("%u checks passed\n", checks);
+	return EXIT_SUCCESS;
+}